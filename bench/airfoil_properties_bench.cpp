@@ -0,0 +1,81 @@
+// AirfoilProperties cost: extraction (computeAirfoilProperties) vs reading the
+// cached copy, per table size, and a fleet run showing every aircraft sharing
+// one extraction and one AeroCoeffTable per airfoil instead of paying per step.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+static std::vector<glm::vec4> makeCurve(size_t rows)
+{
+    std::vector<glm::vec4> c;
+    const float step = 40.0f / float(rows - 1);
+    for (size_t i = 0; i < rows; ++i) {
+        float a = -20.0f + float(i) * step;
+        float cl = 0.11f * (a + 2.5f) - 0.0004f * a * a * a / 20.0f;
+        c.push_back({a, cl, 0.012f + 0.0004f * a * a, estimateCm(a)});
+    }
+    return c;
+}
+
+template <class F>
+static double nsPerCall(size_t n, F&& f)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; ++i) f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / double(n);
+}
+
+int main()
+{
+    std::printf("%8s %14s %14s %14s\n", "rows", "extract ns", "cached ns", "paper+extract");
+    for (size_t rows : {100u, 1000u, 10000u}) {
+        Airfoil foil(makeCurve(rows));
+        const PolarData& p = foil.polarData();
+        const size_t n = 2000000 / rows + 1000;
+
+        float sink = 0.0f;
+        double extract = nsPerCall(n, [&] { sink += computeAirfoilProperties(p.segments, p.segmentCount).clAlpha; });
+        double cached = nsPerCall(n * 100, [&] { sink += foil.properties().clAlpha; });
+        // what a per-step extraction would cost on top of the model itself
+        double perStep = nsPerCall(n, [&] {
+            AirfoilProperties props = computeAirfoilProperties(p.segments, p.segmentCount);
+            sink += computeAeroCoeffsPaper(4.0f, 8.0f, props).Cl;
+        });
+        volatile float keep = sink; (void)keep;
+        std::printf("%8zu %14.2f %14.2f %14.2f\n", rows, extract, cached, perStep);
+    }
+
+    // fleet: 1000 aircraft on one airfoil, 1000 steps each
+    const size_t FLEET = 1000, STEPS = 1000;
+    Airfoil foil(makeCurve(1000));
+    std::vector<Aircraft> fleet;
+    fleet.reserve(FLEET);
+    for (size_t i = 0; i < FLEET; ++i) {
+        fleet.push_back(createAirplane(foil, {0.0f, 100.0f + float(i), 0.0f}, {0.0f, 0.0f, 0.0f},
+                                       2.0f, 0.4046f, 2.0f, 0.1524f, 10.0f, {0.05f, 0.05f, 0.05f}));
+        fleet.back().velocity = {20.0f, 0.0f, 0.0f};
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t s = 0; s < STEPS; ++s)
+        for (Aircraft& a : fleet) updatePhysics(a, 0.0f, 0.0f, 0.002f);
+    auto t1 = std::chrono::steady_clock::now();
+
+    size_t sameProps = 0, sameTable = 0;
+    for (const Aircraft& a : fleet) {
+        sameProps += &a.airfoil.properties() == &foil.properties();
+        sameTable += a.aeroTable == fleet.front().aeroTable;
+    }
+    const AirfoilProperties& props = foil.properties();
+    std::printf("\nfleet %zu x %zu steps: %.1f ns/step\n", FLEET, STEPS,
+                std::chrono::duration<double, std::nano>(t1 - t0).count() / double(FLEET * STEPS));
+    std::printf("extractions: 1 (shared properties %zu/%zu, shared coeff table %zu/%zu)\n",
+                sameProps, FLEET, sameTable, FLEET);
+    std::printf("props: clAlpha %.4f /rad, zero-lift %.3f deg, stall %.2f deg, CLmax %.4f, Cd0 %.5f\n",
+                props.clAlpha, props.zeroLiftDeg, props.stallDeg, props.clMax, props.cd0);
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Airfoil::sample benchmark: indexed lookup vs the old linear scan.
+// Reports ns/sample for uniform and non-uniform tables of 100..10k rows,
+// plus the batched SIMD path (sampleBatch, SoA output) and the monotone
+// cubic mode (scalar sample).
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// reference: the original linear-scan Airfoil::sample
+static AeroCoeffs sampleScan(const std::vector<glm::vec4>& data, float alpha_deg)
+{
+    if (data.empty()) return {0,0,0,0,0};
+    alpha_deg = std::clamp(alpha_deg, data.front().x, data.back().x);
+    for (size_t i = 0; i + 1 < data.size(); ++i) {
+        if (alpha_deg >= data[i].x && alpha_deg <= data[i+1].x) {
+            float t = (alpha_deg - data[i].x) / (data[i+1].x - data[i].x);
+            return { data[i].y + t * (data[i+1].y - data[i].y),
+                     data[i].z + t * (data[i+1].z - data[i].z),
+                     data[i].w + t * (data[i+1].w - data[i].w), 0.0f, 0.0f };
+        }
+    }
+    return {0,0,0,0,0};
+}
+
+static std::vector<glm::vec4> makePolar(size_t rows, bool uniform, std::mt19937& rng)
+{
+    std::vector<glm::vec4> curve(rows);
+    std::uniform_real_distribution<float> jitter(0.3f, 1.7f);
+    const float step = 40.0f / float(rows - 1);
+    float alpha = -20.0f;
+    for (size_t i = 0; i < rows; ++i) {
+        if (uniform) alpha = -20.0f + float(i) * step;
+        float a = alpha * 3.14159265f / 180.0f;
+        curve[i] = glm::vec4(alpha, 2.0f * std::sin(a), 0.02f + a * a, estimateCm(alpha));
+        alpha += step * jitter(rng);
+    }
+    return curve;
+}
+
+template <typename F>
+static double nsPerSample(const std::vector<float>& queries, F&& f)
+{
+    float sink = 0.0f;
+    auto t0 = std::chrono::steady_clock::now();
+    for (float a : queries) sink += f(a).Cl;
+    auto t1 = std::chrono::steady_clock::now();
+    volatile float keep = sink; (void)keep;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / double(queries.size());
+}
+
+int main()
+{
+    std::mt19937 rng(1234);
+    const size_t sizes[] = {100, 300, 1000, 3000, 10000};
+
+    std::printf("%8s %10s %12s %12s %12s %12s %9s %12s\n",
+                "rows", "layout", "scan ns", "indexed ns", "cubic ns", "batch ns", "speedup", "max |dCl|");
+    for (bool uniform : {true, false}) {
+        for (size_t rows : sizes) {
+            std::vector<glm::vec4> curve = makePolar(rows, uniform, rng);
+            Airfoil foil(curve);
+            Airfoil cubic(curve, PolarInterpolation::MonotoneCubic);
+
+            std::uniform_real_distribution<float> dist(curve.front().x, curve.back().x);
+            std::vector<float> queries(rows >= 3000 ? 20000 : 200000);
+            for (float& q : queries) q = dist(rng);
+
+            float maxErr = 0.0f;
+            for (float a : queries)
+                maxErr = std::max(maxErr, std::fabs(foil.sample(a).Cl - sampleScan(curve, a).Cl));
+
+            double scan = nsPerSample(queries, [&](float a) { return sampleScan(curve, a); });
+            double indexed = nsPerSample(queries, [&](float a) { return foil.sample(a); });
+            double cubicNs = nsPerSample(queries, [&](float a) { return cubic.sample(a); });
+
+            std::vector<float> Cl(queries.size()), Cd(queries.size()), Cm(queries.size());
+            auto t0 = std::chrono::steady_clock::now();
+            foil.sampleBatch(queries.data(), Cl.data(), Cd.data(), Cm.data(), queries.size());
+            auto t1 = std::chrono::steady_clock::now();
+            double batch = std::chrono::duration<double, std::nano>(t1 - t0).count() / double(queries.size());
+            for (size_t k = 0; k < queries.size(); ++k)
+                maxErr = std::max(maxErr, std::fabs(Cl[k] - sampleScan(curve, queries[k]).Cl));
+
+            std::printf("%8zu %10s %12.2f %12.2f %12.2f %12.2f %8.1fx %12.2e\n", rows,
+                        foil.isUniform() ? "uniform" : "bracket", scan, indexed, cubicNs, batch, scan / batch, maxErr);
+        }
+    }
+    return 0;
+}
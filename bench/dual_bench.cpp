@@ -0,0 +1,175 @@
+// Dual-number derivatives against finite differences: dCl/dalpha of the
+// paper model, the full 13 x 17 aircraftJacobian for the lumped and
+// stability-table models (largest difference to central differences, and
+// the time for one dual pass against the 18 evaluations of a forward-
+// difference Jacobian), then the trim envelope solved with exact and with
+// finite-difference Jacobians.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "trim.h"
+#include "builtinpolars.h"
+#include "stability.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+static double usSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// the 13 state coordinates of aircraftJacobian, in order
+static float* stateCoord(RigidState& s, int i)
+{
+    float* p[AIRCRAFT_STATE_SIZE] = {
+        &s.position.x, &s.position.y, &s.position.z, &s.velocity.x, &s.velocity.y, &s.velocity.z,
+        &s.orientation.w, &s.orientation.x, &s.orientation.y, &s.orientation.z,
+        &s.angularVelocity.x, &s.angularVelocity.y, &s.angularVelocity.z,
+    };
+    return p[i];
+}
+
+static float inputCoord(Aircraft& plane, int i)
+{
+    return i == 0 ? plane.thrust : plane.controls[i - 1];
+}
+
+static void setInput(Aircraft& plane, int i, float v)
+{
+    if (i == 0) plane.thrust = v;
+    else plane.controls[i - 1] = v;
+}
+
+static void packDerivative(const RigidDerivative& d, float* f)
+{
+    const float v[AIRCRAFT_STATE_SIZE] = {
+        d.dPosition.x, d.dPosition.y, d.dPosition.z, d.dVelocity.x, d.dVelocity.y, d.dVelocity.z,
+        d.dOrientation.w, d.dOrientation.x, d.dOrientation.y, d.dOrientation.z,
+        d.dAngularVelocity.x, d.dAngularVelocity.y, d.dAngularVelocity.z,
+    };
+    std::copy(v, v + AIRCRAFT_STATE_SIZE, f);
+}
+
+// central differences of column j (state, then inputs), steps of +-h
+static void centralColumn(Aircraft plane, const RigidState& s, int j, float h, float* col)
+{
+    float fp[AIRCRAFT_STATE_SIZE], fm[AIRCRAFT_STATE_SIZE];
+    for (int side = 0; side < 2; ++side) {
+        RigidState x = s;
+        Aircraft p = plane;
+        const float step = side ? -h : h;
+        if (j < AIRCRAFT_STATE_SIZE) *stateCoord(x, j) += step;
+        else setInput(p, j - AIRCRAFT_STATE_SIZE, inputCoord(p, j - AIRCRAFT_STATE_SIZE) + step);
+        packDerivative(aircraftDerivative(p, x, false, false), side ? fm : fp);
+    }
+    for (int i = 0; i < AIRCRAFT_STATE_SIZE; ++i) col[i] = (fp[i] - fm[i]) / (2.0f * h);
+}
+
+static void jacobianRow(const char* name, Aircraft& plane)
+{
+    const RigidState s = aircraftState(plane);
+    AircraftJacobian J;
+    if (!aircraftJacobian(plane, s, J)) return;
+
+    // relative to the column's scale, so m/s^2 and rad/s^2 rows compare
+    float worst = 0.0f;
+    for (int j = 0; j < AIRCRAFT_STATE_SIZE + AIRCRAFT_INPUT_SIZE; ++j) {
+        float col[AIRCRAFT_STATE_SIZE];
+        centralColumn(plane, s, j, j == AIRCRAFT_STATE_SIZE ? 1e-2f : 1e-3f, col);
+        float scale = 1e-3f, err = 0.0f;
+        for (int i = 0; i < AIRCRAFT_STATE_SIZE; ++i) {
+            const float a = j < AIRCRAFT_STATE_SIZE ? J.A[i][j] : J.B[i][j - AIRCRAFT_STATE_SIZE];
+            scale = std::max(scale, std::fabs(a));
+            err = std::max(err, std::fabs(a - col[i]));
+        }
+        worst = std::max(worst, err / scale);
+    }
+
+    const int reps = 2000;
+    volatile float sink = 0.0f;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r) {
+        aircraftJacobian(plane, s, J);
+        sink = sink + J.A[3][6];
+    }
+    const double tDual = usSince(t0) / reps;
+
+    t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r) {
+        RigidDerivative d = aircraftDerivative(plane, s, false, false);
+        for (int j = 0; j < AIRCRAFT_STATE_SIZE + AIRCRAFT_INPUT_SIZE; ++j) {
+            RigidState x = s;
+            Aircraft& p = plane;
+            const float keep = j < AIRCRAFT_STATE_SIZE ? 0.0f : inputCoord(p, j - AIRCRAFT_STATE_SIZE);
+            if (j < AIRCRAFT_STATE_SIZE) *stateCoord(x, j) += 1e-3f;
+            else setInput(p, j - AIRCRAFT_STATE_SIZE, keep + 1e-3f);
+            RigidDerivative dj = aircraftDerivative(p, x, false, false);
+            if (j >= AIRCRAFT_STATE_SIZE) setInput(p, j - AIRCRAFT_STATE_SIZE, keep);
+            sink = sink + (dj.dVelocity.x - d.dVelocity.x);
+        }
+    }
+    const double tFd = usSince(t0) / reps;
+    std::printf("%-10s %14.2e %10.2f us %10.2f us %8.2fx\n", name, worst, tDual, tFd, tFd / tDual);
+}
+
+int main()
+{
+    // dCl/dalpha: dual against central differences, away from the model's kinks
+    const AirfoilProperties props = builtinAirfoil<NACA_4412>().properties();
+    float worstCl = 0.0f, worstCd = 0.0f;
+    for (float a = -30.0f; a <= 30.0f; a += 0.37f) {
+        PaperCoeffs<Dual<6>> c = paperCoeffs(Dual<6>::variable(a, 0), 5.0f, props);
+        const float h = 1e-2f;
+        PaperCoeffs<float> p = paperCoeffs(a + h, 5.0f, props), m = paperCoeffs(a - h, 5.0f, props);
+        const float dCl = (p.Cl - m.Cl) / (2.0f * h), dCd = (p.Cd - m.Cd) / (2.0f * h);
+        if (std::fabs(dCl - c.Cl.d[0]) > 0.1f * std::fabs(dCl) + 1e-2f) continue;  // straddles a kink
+        worstCl = std::max(worstCl, std::fabs(dCl - c.Cl.d[0]));
+        worstCd = std::max(worstCd, std::fabs(dCd - c.Cd.d[0]));
+    }
+    std::printf("paper model, alpha -30..30 deg: |dCl/dalpha dual - central| <= %.2e, dCd/dalpha <= %.2e (per deg)\n\n",
+                worstCl, worstCd);
+
+    Aircraft lumped = createAirplane(builtinAirfoil<NACA_4412>(), {0.0f, 30.0f, 0.0f}, {14.0f, -0.5f, 0.8f},
+                                     2.0f, 0.4046f, 2.0f, 0.1524f, 4.0f, {0.05f, 0.05f, 0.05f});
+    lumped.orientation = glm::angleAxis(0.05f, glm::vec3(0.0f, 0.0f, 1.0f)) *
+                         glm::angleAxis(0.2f, glm::vec3(1.0f, 0.0f, 0.0f));
+    lumped.angularVelocity = {0.1f, -0.2f, 0.05f};
+    lumped.controls = {0.02f, -0.05f, 0.01f};
+    Aircraft stability = lumped;
+    stability.stability = defaultStabilityTable();
+
+    std::printf("%-10s %14s %13s %13s %9s\n", "model", "max rel err", "dual pass", "fwd diff", "speedup");
+    jacobianRow("lumped", lumped);
+    jacobianRow("stability", stability);
+
+    // trim envelope with exact and finite-difference Jacobians
+    std::vector<TrimCondition> envelope;
+    for (float speed = 8.0f; speed <= 30.0f; speed += 1.0f)
+        for (float climb = -6.0f; climb <= 10.0f; climb += 2.0f)
+            for (float turn = -0.6f; turn <= 0.61f; turn += 0.2f)
+                envelope.push_back({speed, climb, turn});
+    const size_t n = envelope.size();
+    TrimOptions exactOptions;
+    exactOptions.exactJacobian = true;
+
+    std::printf("\n%zu trim conditions\n%-10s %-8s %10s %9s %10s\n", n, "model", "jacobian", "time", "trimmed",
+                "mean iter");
+    struct Row { const char* name; const Aircraft* plane; };
+    for (Row row : {Row{"lumped", &lumped}, Row{"stability", &stability}}) {
+        for (int exact = 1; exact >= 0; --exact) {
+            std::vector<TrimSolution> out(n);
+            auto t0 = std::chrono::steady_clock::now();
+            trimAircraft(*row.plane, envelope.data(), out.data(), n, exact ? exactOptions : TrimOptions());
+            const double ms = usSince(t0) / 1000.0;
+            size_t ok = 0, iters = 0;
+            for (const TrimSolution& s : out) {
+                ok += s.converged;
+                iters += size_t(s.iterations);
+            }
+            std::printf("%-10s %-8s %7.1f ms %4zu/%-4zu %10.2f\n", row.name, exact ? "dual" : "fd", ms, ok, n,
+                        double(iters) / double(n));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+// Fleet throughput: 100k lumped-model aircraft stepped one Aircraft at a time
+// vs through AircraftFleet columns (scalar kernel, then the widest vector
+// one), in aircraft-steps per core-second; the largest divergence of the
+// scalar fleet from the Aircraft path after 2 s of flight, and the vector
+// kernel's velocity divergence from the scalar fleet (median, p99, max and
+// how many aircraft are more than 0.1 m/s off) - the price of opting in.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include "builtinpolars.h"
+#include "fleet.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+static double secondsSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main()
+{
+    const size_t N = 100000;
+    const int STEPS = 200;            // 2 s at 100 Hz
+    const float dt = 0.01f;
+
+    Airfoil foil = builtinAirfoil<NACA_4412>();
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+
+    std::vector<Aircraft> planes;
+    planes.reserve(N);
+    for (size_t i = 0; i < N; ++i) {
+        Aircraft a = createAirplane(foil, {0.0f, 500.0f, 0.0f}, {5.0f * u(rng), 0.0f, 10.0f * u(rng)},
+                                    2.0f, 0.4046f, 2.0f, 0.1524f, 10.0f, {0.05f, 0.05f, 0.05f});
+        a.velocity = {20.0f + u(rng), u(rng), u(rng)};
+        a.angularVelocity = {0.5f * u(rng), 0.2f * u(rng), 0.2f * u(rng)};
+        planes.push_back(a);
+    }
+
+    AircraftFleet fleet;
+    fleet.reserve(N);
+    for (const Aircraft& a : planes) fleet.add(a);
+    AircraftFleet vector = fleet;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int s = 0; s < STEPS; ++s)
+        for (Aircraft& a : planes) updatePhysics(a, 0.0f, 0.0f, dt);
+    double tScalar = secondsSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    for (int s = 0; s < STEPS; ++s) updatePhysicsBatch(fleet, dt, FleetKernel::Scalar);
+    double tFleet = secondsSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    for (int s = 0; s < STEPS; ++s) updatePhysicsBatch(vector, dt, FleetKernel::Auto);
+    double tVector = secondsSince(t0);
+
+    float dPos = 0.0f, dVel = 0.0f, dRot = 0.0f;
+    Aircraft b(foil);
+    for (size_t i = 0; i < N; ++i) {
+        fleet.read(i, b);
+        dPos = std::max(dPos, glm::length(planes[i].position - b.position));
+        dVel = std::max(dVel, glm::length(planes[i].velocity - b.velocity));
+        dRot = std::max(dRot, glm::length(glm::vec4(planes[i].orientation.x - b.orientation.x,
+                                                    planes[i].orientation.y - b.orientation.y,
+                                                    planes[i].orientation.z - b.orientation.z,
+                                                    planes[i].orientation.w - b.orientation.w)));
+    }
+
+    std::vector<float> dVector(N);
+    size_t off = 0;
+    for (size_t i = 0; i < N; ++i) {
+        dVector[i] = glm::length(glm::vec3(vector.vx[i] - fleet.vx[i], vector.vy[i] - fleet.vy[i],
+                                           vector.vz[i] - fleet.vz[i]));
+        off += dVector[i] > 0.1f;
+    }
+    std::sort(dVector.begin(), dVector.end());
+
+    const double work = double(N) * STEPS;
+    std::printf("%zu aircraft x %d steps, %zu aero type(s)\n", N, STEPS, fleet.types.size());
+    std::printf("%-10s %10s %18s\n", "path", "s", "aircraft-steps/s");
+    std::printf("%-10s %10.3f %18.3e\n", "Aircraft", tScalar, work / tScalar);
+    std::printf("%-10s %10.3f %18.3e\n", "fleet", tFleet, work / tFleet);
+    std::printf("%-10s %10.3f %18.3e\n", fleetKernelName(fleetBestKernel()), tVector, work / tVector);
+    std::printf("fleet vs Aircraft max diff: position %.3e m, velocity %.3e m/s, orientation %.3e\n", dPos, dVel,
+                dRot);
+    std::printf("%s vs scalar fleet velocity diff: median %.2e, p99 %.2e, max %.2e m/s; %zu/%zu over 0.1 m/s\n",
+                fleetKernelName(fleetBestKernel()), dVector[N / 2], dVector[N * 99 / 100], dVector[N - 1], off, N);
+    return 0;
+}
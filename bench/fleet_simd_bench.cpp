@@ -0,0 +1,66 @@
+// Fleet kernel throughput: scalar vs SSE (4 lanes), AVX2 (8) and AVX-512
+// (16) on the same 100k-aircraft fleet, in aircraft-steps per core-second,
+// with each vector kernel's velocity divergence from the scalar one after
+// 2 s. Most lanes agree to float noise; the tail is lanes whose AoA landed
+// on the other side of a quarter-degree rounding boundary (polynomial
+// atan2) and then diverged in post-stall tumbling, hence median/p99/max.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include "builtinpolars.h"
+#include "fleet.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+int main()
+{
+    const size_t N = 100000;
+    const int STEPS = 200;            // 2 s at 100 Hz
+    const float dt = 0.01f;
+
+    Airfoil foil = builtinAirfoil<NACA_4412>();
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+
+    AircraftFleet start;
+    start.reserve(N);
+    for (size_t i = 0; i < N; ++i) {
+        // two wing sizes, so the kernels index more than one table
+        float span = (i & 1) ? 2.0f : 2.6f;
+        Aircraft a = createAirplane(foil, {0.0f, 500.0f, 0.0f}, {5.0f * u(rng), 0.0f, 10.0f * u(rng)},
+                                    2.0f, 0.4046f, span, 0.1524f, 10.0f, {0.05f, 0.05f, 0.05f});
+        a.velocity = {20.0f + u(rng), u(rng), u(rng)};
+        a.angularVelocity = {0.5f * u(rng), 0.2f * u(rng), 0.2f * u(rng)};
+        start.add(a);
+    }
+
+    AircraftFleet reference = start;
+    for (int s = 0; s < STEPS; ++s) updatePhysicsBatch(reference, dt, FleetKernel::Scalar);
+
+    std::printf("%zu aircraft x %d steps, best kernel: %s\n", N, STEPS, fleetKernelName(fleetBestKernel()));
+    std::printf("%-8s %9s %18s %8s %11s %11s %11s\n", "kernel", "s", "aircraft-steps/s", "speedup",
+                "dvel p50", "dvel p99", "dvel max");
+    double tScalar = 0.0;
+    for (FleetKernel k : {FleetKernel::Scalar, FleetKernel::SSE, FleetKernel::AVX2, FleetKernel::AVX512}) {
+        if (!fleetKernelSupported(k)) {
+            std::printf("%-8s %9s\n", fleetKernelName(k), "n/a");
+            continue;
+        }
+        AircraftFleet fleet = start;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int s = 0; s < STEPS; ++s) updatePhysicsBatch(fleet, dt, k);
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        if (k == FleetKernel::Scalar) tScalar = t;
+
+        std::vector<float> dVel(N);
+        for (size_t i = 0; i < N; ++i)
+            dVel[i] = glm::length(glm::vec3(fleet.vx[i] - reference.vx[i], fleet.vy[i] - reference.vy[i],
+                                            fleet.vz[i] - reference.vz[i]));
+        std::sort(dVel.begin(), dVel.end());
+        std::printf("%-8s %9.3f %18.3e %8.2f %11.2e %11.2e %11.2e\n", fleetKernelName(k), t, double(N) * STEPS / t,
+                    tScalar / t, dVel[N / 2], dVel[N * 99 / 100], dVel[N - 1]);
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+// Integrator accuracy vs dt: one aircraft flown for 2 s through a rolling
+// pull-up with each policy from integrators.h, against an RK4 reference at
+// dt = 1e-4 s. Altitude does not enter the loads, so the run starts at the
+// origin to keep float round-off in the position small. Prints the final
+// position / attitude error, derivative evaluations and wall time per dt;
+// RK45 also reports its accepted / rejected substeps (dt is then only the
+// call interval).
+//
+// "Euler (table)" is the default updatePhysics path with the AoA rounded to
+// the quarter degree; "Euler (linear)" is the same method on the
+// interpolated table the other policies use, which isolates the order of
+// the method from the table quantization. The interpolated table still has
+// a slope break every quarter degree, so the higher-order curves are not
+// monotone: how the steps straddle the breaks matters as much as dt.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include "builtinpolars.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+
+struct LinearEuler : SemiImplicitEuler {
+    static constexpr bool quantizeAoA = false;
+};
+
+static Aircraft makePlane(const Airfoil& foil)
+{
+    Aircraft a = createAirplane(foil, {0.0f, 0.0f, 0.0f}, {4.0f, 0.0f, 0.0f},
+                                2.0f, 0.4046f, 2.0f, 0.1524f, 12.0f, {0.4f, 0.6f, 0.8f});
+    a.velocity = {22.0f, 1.0f, 0.5f};
+    a.angularVelocity = {0.6f, 0.15f, 0.1f};
+    return a;
+}
+
+struct Run {
+    Aircraft plane;
+    int evaluations = 0;
+    double seconds = 0.0;
+};
+
+// T seconds at step dt, counting derivative evaluations
+template <class Integrator>
+static Run fly(const Airfoil& foil, float T, float dt, Integrator& integrator)
+{
+    Run r{makePlane(foil)};
+    const int steps = int(T / dt + 0.5f);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int s = 0; s < steps; ++s) {
+        RigidState st = aircraftState(r.plane);
+        integrator.step([&](const RigidState& x) {
+            ++r.evaluations;
+            return aircraftDerivative(r.plane, x, false, Integrator::quantizeAoA);
+        }, st, dt);
+        setAircraftState(r.plane, st);
+    }
+    r.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return r;
+}
+
+static float attitudeErrorDeg(const glm::quat& a, const glm::quat& b)
+{
+    // angle of the relative rotation; asin of the vector part keeps
+    // resolution where acos(w) would round to zero
+    glm::quat d = glm::conjugate(a) * b;
+    float s = std::min(1.0f, glm::length(glm::vec3(d.x, d.y, d.z)));
+    return glm::degrees(2.0f * std::asin(s));
+}
+
+template <class Integrator>
+static void sweep(const char* label, const Airfoil& foil, const Aircraft& ref, float T)
+{
+    for (float dt : {1.0f / 30.0f, 1.0f / 60.0f, 1.0f / 120.0f, 1.0f / 240.0f, 1.0f / 480.0f, 1.0f / 960.0f}) {
+        Integrator integrator;
+        Run r = fly(foil, T, dt, integrator);
+        std::printf("%-16s %8.5f %12.3e %12.3e %10d %10.3f", label, dt,
+                    glm::length(r.plane.position - ref.position),
+                    attitudeErrorDeg(r.plane.orientation, ref.orientation),
+                    r.evaluations, r.seconds * 1e3);
+        if constexpr (std::is_same_v<Integrator, RK45>)
+            std::printf("   %d accepted, %d rejected", integrator.accepted, integrator.rejected);
+        std::printf("\n");
+    }
+}
+
+int main()
+{
+    const float T = 2.0f;
+    Airfoil foil = builtinAirfoil<NACA_4412>();
+
+    RK4 refIntegrator;
+    Aircraft ref = fly(foil, T, 1e-4f, refIntegrator).plane;
+    std::printf("reference: RK4 dt=1e-4, final position (%.3f, %.3f, %.3f)\n\n",
+                ref.position.x, ref.position.y, ref.position.z);
+
+    std::printf("%-16s %8s %12s %12s %10s %10s\n", "integrator", "dt", "|dx| m", "attitude deg", "evals", "ms");
+    sweep<SemiImplicitEuler>("Euler (table)", foil, ref, T);
+    sweep<LinearEuler>("Euler (linear)", foil, ref, T);
+    sweep<VelocityVerlet>("velocity Verlet", foil, ref, T);
+    sweep<RK4>("RK4", foil, ref, T);
+    sweep<RK45>("RK45", foil, ref, T);
+    return 0;
+}
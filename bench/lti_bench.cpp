@@ -0,0 +1,128 @@
+// Linear propagation around a trim point: the stability-model aircraft
+// trimmed level at 15 m/s, linearized and discretized at 120 Hz, then
+// 2 s of random perturbations of growing size stepped on the linear model
+// and on updatePhysics (RK4). Reports aircraft-steps/s for both, how many
+// aircraft drifted out of the limits and the mean linear steps taken, how
+// far the linear result is from the nonlinear one for those that stayed
+// in, and the same after the drifted ones finish on nonlinear steps.
+// Scale 0 stays at the trim point: no aircraft drift, so that row is the
+// full-length throughput.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "linearize.h"
+#include "trim.h"
+#include "builtinpolars.h"
+#include "stability.h"
+#include "threadpool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+static double secondsSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+struct Errors {
+    float speed = 0.0f, attitude = 0.0f, rate = 0.0f;   // largest differences
+};
+
+static void compare(const Aircraft& a, const Aircraft& b, Errors& e)
+{
+    e.speed = std::max(e.speed, glm::length(a.velocity - b.velocity));
+    float d = std::min(1.0f, std::fabs(glm::dot(a.orientation, b.orientation)));
+    e.attitude = std::max(e.attitude, 2.0f * std::acos(d));
+    e.rate = std::max(e.rate, glm::length(a.angularVelocity - b.angularVelocity));
+}
+
+int main()
+{
+    Aircraft plane = createAirplane(builtinAirfoil<NACA_4412>(), {0.0f, 30.0f, 0.0f}, {0.0f, 0.0f, 0.0f},
+                                    2.0f, 0.4046f, 2.0f, 0.1524f, 0.0f, {0.05f, 0.05f, 0.05f});
+    plane.stability = defaultStabilityTable();
+    TrimSolution trim = trimAircraft(plane, TrimCondition{15.0f, 0.0f, 0.0f});
+    if (!trim.converged) return 1;
+    applyTrim(plane, trim);
+
+    LinearModel model;
+    linearizeAircraft(plane, model);
+    const float dt = 1.0f / 120.0f;
+    const int steps = 240;
+    LtiFleet base;
+    if (!base.init(model, dt)) return 1;
+    std::printf("stability model trimmed level at 15 m/s, linearized (%s), %d steps of %.4f s\n",
+                model.exact ? "dual numbers" : "differences", steps, dt);
+    std::printf("limits: speed %.2f m/s, attitude %.3f rad, rate %.2f rad/s\n\n", base.limits.speed,
+                base.limits.attitude, base.limits.rate);
+
+    const size_t n = 8192;
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    ThreadPool pool({hw});
+    RK4 rk4;
+
+    std::printf("%6s %12s %12s %12s %10s %6s %24s %24s\n", "scale", "lti 1 thr", "lti pool", "nonlinear", "drifted",
+                "steps", "in-limits err (v,att,w)", "after fallback (v,att,w)");
+    for (float scale : {0.0f, 0.1f, 0.25f, 0.5f, 1.0f}) {
+        // velocity, attitude and rate perturbations, reproducible
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> uni(-1.0f, 1.0f);
+        std::vector<Aircraft> start(n, plane);
+        for (Aircraft& a : start) {
+            a.velocity += scale * glm::vec3(0.3f * uni(rng), 0.3f * uni(rng), 0.3f * uni(rng));
+            glm::vec3 axis(uni(rng), uni(rng), uni(rng));
+            a.orientation = glm::normalize(a.orientation * glm::angleAxis(scale * 0.02f, glm::normalize(axis)));
+            a.angularVelocity += scale * glm::vec3(0.05f * uni(rng), 0.05f * uni(rng), 0.05f * uni(rng));
+        }
+
+        LtiFleet serial = base, parallel = base;
+        serial.reserve(n);
+        parallel.reserve(n);
+        for (const Aircraft& a : start) {
+            serial.add(a);
+            parallel.add(a);
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        size_t drifted = propagateLti(serial, steps);
+        const double tSerial = secondsSince(t0);
+        t0 = std::chrono::steady_clock::now();
+        propagateLti(pool, parallel, steps);
+        const double tPool = secondsSince(t0);
+
+        // nonlinear reference on every aircraft (timed)
+        std::vector<Aircraft> nonlinear = start;
+        t0 = std::chrono::steady_clock::now();
+        for (Aircraft& a : nonlinear)
+            for (int s = 0; s < steps; ++s) updatePhysics(a, dt, rk4);
+        const double tNonlinear = secondsSince(t0);
+
+        Errors inLimits, all;
+        bool same = true;
+        size_t linearSteps = 0;
+        for (size_t i = 0; i < n; ++i) {
+            same = same && serial.stepsTaken[i] == parallel.stepsTaken[i] && serial.dx[3][i] == parallel.dx[3][i];
+            linearSteps += serial.stepsTaken[i];
+            Aircraft a = plane;
+            serial.read(i, a);
+            if (serial.drifted[i]) {
+                // fall back: the rest of the run on nonlinear steps
+                for (int s = int(serial.stepsTaken[i]); s < steps; ++s) updatePhysics(a, dt, rk4);
+            } else {
+                compare(a, nonlinear[i], inLimits);
+            }
+            compare(a, nonlinear[i], all);
+        }
+
+        const double rate = double(n) * steps;
+        char in[32], fb[32];
+        std::snprintf(in, sizeof(in), "%.4f %.4f %.4f", inLimits.speed, inLimits.attitude, inLimits.rate);
+        std::snprintf(fb, sizeof(fb), "%.4f %.4f %.4f", all.speed, all.attitude, all.rate);
+        std::printf("%6.2f %10.2e/s %10.2e/s %10.2e/s %5zu/%-4zu %6.1f %24s %24s%s\n", scale, rate / tSerial,
+                    rate / tPool, rate / tNonlinear, drifted, n, double(linearSteps) / double(n), in, fb,
+                    same ? "" : "  (pool result differs!)");
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+// Orientation update at large steps, 1x to 8x the 120 Hz step, errors in
+// degrees after the run against a 64x finer reference:
+//   1) prescribed body rates, a fast roll (8 rad/s) with coning: the
+//      orientation update alone, no dynamics;
+//   2) an Aircraft in a high-rate roll, with the default semi-implicit
+//      Euler step and with RK4 (RKMK for ExpMap / Magnus). The Euler rows
+//      are limited by its first-order rate update whatever the rotation;
+//   3) a phi::RigidBody spinning about a principal axis (constant rate,
+//      exact answer known).
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include "builtinpolars.h"
+#include "phi.h"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+static float angleDeg(const glm::quat& a, const glm::quat& b)
+{
+    glm::quat d = glm::conjugate(a) * b;
+    float s = std::min(1.0f, glm::length(glm::vec3(d.x, d.y, d.z)));
+    return glm::degrees(2.0f * std::asin(s));
+}
+
+// rates and attitude for section 1: w(t) = (8, 1.5 cos 3t, 1.5 sin 3t)
+static glm::vec3 coningRate(float t)
+{
+    return {8.0f, 1.5f * std::cos(3.0f * t), 1.5f * std::sin(3.0f * t)};
+}
+
+static glm::quat cone(OrientationUpdate mode, float dt, float T)
+{
+    glm::quat q(1.0f, 0.0f, 0.0f, 0.0f);
+    const int steps = int(T / dt + 0.5f);
+    for (int s = 0; s < steps; ++s)
+        q = advanceOrientation(q, coningRate(float(s) * dt), coningRate(float(s + 1) * dt), dt, mode);
+    return q;
+}
+
+template <class Integrator>
+static Aircraft fly(const Airfoil& foil, OrientationUpdate mode, float dt, float T)
+{
+    Aircraft a = createAirplane(foil, {0.0f, 0.0f, 0.0f}, {3.0f, 0.0f, 0.0f},
+                                2.0f, 0.4046f, 2.0f, 0.1524f, 12.0f, {0.3f, 0.6f, 0.6f});
+    a.velocity = {25.0f, 0.0f, 0.0f};
+    a.angularVelocity = {8.0f, 0.0f, 0.0f};
+    a.orientationUpdate = mode;
+    const int steps = int(T / dt + 0.5f);
+    for (int s = 0; s < steps; ++s) updatePhysics<Integrator>(a, dt);
+    return a;
+}
+
+static phi::RigidBody spin(phi::RotationIntegration mode, float dt, float T)
+{
+    phi::RigidBodyParams params;
+    params.inertia = phi::inertia::tensor(glm::vec3(1.0f, 2.0f, 3.0f));
+    params.angular_velocity = {6.0f, 0.0f, 0.0f};
+    params.apply_gravity = false;
+    params.rotation_integration = mode;
+    phi::RigidBody b(params);
+    const int steps = int(T / dt + 0.5f);
+    for (int s = 0; s < steps; ++s) b.update(dt);
+    return b;
+}
+
+static const OrientationUpdate MODES[] = {OrientationUpdate::Linear, OrientationUpdate::ExpMap,
+                                          OrientationUpdate::Magnus};
+
+static void header(const char* title, float T)
+{
+    std::printf("\n%s, attitude error (deg) after %.0f s\n%8s %12s %12s %12s\n", title, T, "step",
+                "Linear", "ExpMap", "Magnus");
+}
+
+template <class Integrator>
+static void aircraftTable(const char* title, const Airfoil& foil, float base, float T)
+{
+    header(title, T);
+    for (int mult : {1, 2, 4, 8}) {
+        std::printf("%7dx", mult);
+        for (OrientationUpdate mode : MODES) {
+            Aircraft ref = fly<Integrator>(foil, mode, base / 64.0f, T);
+            std::printf(" %12.3e", angleDeg(fly<Integrator>(foil, mode, base * float(mult), T).orientation,
+                                            ref.orientation));
+        }
+        std::printf("\n");
+    }
+}
+
+int main()
+{
+    const float T = 1.0f;
+    const float base = 1.0f / 120.0f;
+    Airfoil foil = builtinAirfoil<NACA_4412>();
+
+    glm::quat coneRef = cone(OrientationUpdate::Magnus, base / 64.0f, T);
+    header("Prescribed roll + coning rates", T);
+    for (int mult : {1, 2, 4, 8}) {
+        std::printf("%7dx", mult);
+        for (OrientationUpdate mode : MODES)
+            std::printf(" %12.3e", angleDeg(cone(mode, base * float(mult), T), coneRef));
+        std::printf("\n");
+    }
+
+    aircraftTable<SemiImplicitEuler>("Aircraft roll, semi-implicit Euler", foil, base, T);
+    aircraftTable<RK4>("Aircraft roll, RK4", foil, base, T);
+
+    // constant rate: the exact attitude is a rotation by 6 T rad about x
+    const glm::quat spinExact = glm::angleAxis(6.0f * T, glm::vec3(1.0f, 0.0f, 0.0f));
+    header("phi::RigidBody principal-axis spin", T);
+    for (int mult : {1, 2, 4, 8}) {
+        std::printf("%7dx", mult);
+        for (auto mode : {phi::RotationIntegration::linear, phi::RotationIntegration::exponential,
+                          phi::RotationIntegration::magnus})
+            std::printf(" %12.3e", angleDeg(spin(mode, base * float(mult), T).rotation, spinExact));
+        std::printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+// Compile-time physics variants: 100k lumped-model aircraft stepped with
+// each updatePhysics<Features> preset. FULL_PHYSICS must leave the same
+// bits as the legacy updatePhysics(plane, 0, 0, dt).
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include "builtinpolars.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// best of three runs of `steps` steps over a copy of planes; the state
+// after the last run goes to *out
+template <class Step>
+static double rate(const std::vector<Aircraft>& planes, int steps, Step&& step, std::vector<Aircraft>* out = nullptr)
+{
+    double best = 0.0;
+    for (int run = 0; run < 3; ++run) {
+        std::vector<Aircraft> work = planes;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int s = 0; s < steps; ++s)
+            for (Aircraft& a : work) step(a);
+        double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        best = std::max(best, double(work.size()) * steps / sec);
+        if (out) *out = std::move(work);
+    }
+    return best;
+}
+
+static bool sameState(const std::vector<Aircraft>& a, const std::vector<Aircraft>& b)
+{
+    for (size_t i = 0; i < a.size(); ++i)
+        if (std::memcmp(&a[i].position, &b[i].position, sizeof(glm::vec3)) != 0 ||
+            std::memcmp(&a[i].orientation, &b[i].orientation, sizeof(glm::quat)) != 0 ||
+            std::memcmp(&a[i].angularVelocity, &b[i].angularVelocity, sizeof(glm::vec3)) != 0)
+            return false;
+    return true;
+}
+
+int main()
+{
+    const size_t N = 100000;
+    const int STEPS = 20;
+    const float dt = 0.01f;
+
+    Airfoil foil = builtinAirfoil<NACA_4412>();
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+    std::vector<Aircraft> planes;
+    planes.reserve(N);
+    for (size_t i = 0; i < N; ++i) {
+        Aircraft a = createAirplane(foil, {0.0f, 500.0f, 0.0f}, {5.0f * u(rng), 0.0f, 10.0f * u(rng)},
+                                    2.0f, 0.4046f, 2.0f, 0.1524f, 10.0f, {0.05f, 0.05f, 0.05f});
+        a.velocity = {20.0f + u(rng), u(rng), u(rng)};
+        a.angularVelocity = {0.5f * u(rng), 0.2f * u(rng), 0.2f * u(rng)};
+        planes.push_back(a);
+    }
+
+    std::vector<Aircraft> legacy, full;
+    double legacyRate = rate(planes, STEPS, [&](Aircraft& a) { updatePhysics(a, 0.0f, 0.0f, dt); }, &legacy);
+    double fullRate = rate(planes, STEPS, [&](Aircraft& a) { updatePhysics<FULL_PHYSICS>(a, dt); }, &full);
+    double quietRate = rate(planes, STEPS, [&](Aircraft& a) { updatePhysics<NO_DIAGNOSTICS_PHYSICS>(a, dt); });
+    double noGyroRate = rate(planes, STEPS, [&](Aircraft& a) { updatePhysics<NO_GYRO_PHYSICS>(a, dt); });
+    double pointRate = rate(planes, STEPS, [&](Aircraft& a) { updatePhysics<POINT_MASS_PHYSICS>(a, dt); });
+
+    std::printf("%-24s %14s %8s\n", "variant", "steps/s", "speedup");
+    std::printf("%-24s %14.3e %8.2f\n", "legacy updatePhysics", legacyRate, 1.0);
+    std::printf("%-24s %14.3e %8.2f   %s\n", "FULL_PHYSICS", fullRate, fullRate / legacyRate,
+                sameState(legacy, full) ? "bit-identical" : "MISMATCH");
+    std::printf("%-24s %14.3e %8.2f\n", "NO_DIAGNOSTICS_PHYSICS", quietRate, quietRate / legacyRate);
+    std::printf("%-24s %14.3e %8.2f\n", "NO_GYRO_PHYSICS", noGyroRate, noGyroRate / legacyRate);
+    std::printf("%-24s %14.3e %8.2f\n", "POINT_MASS_PHYSICS", pointRate, pointRate / legacyRate);
+    return 0;
+}
@@ -0,0 +1,94 @@
+// PolarGrid lookup latency vs table dimensionality (1D alpha, 2D alpha x Re,
+// 3D alpha x Re x Mach), for random and step-coherent query streams, with
+// and without the last-cell hint.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include "polargrid.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+struct Query { float alpha, re, mach; };
+
+// multilinear in each variable, so the grid must reproduce it exactly
+static glm::vec3 reference(float a, float re, float m)
+{
+    float r = re * 1e-6f;
+    return glm::vec3(0.1f * a + 0.3f * r + 0.02f * a * r - 0.05f * a * m,
+                     0.02f + 0.001f * a * r * m,
+                     -0.05f - 0.01f * m);
+}
+
+static std::shared_ptr<const PolarGrid> makeGrid(int dims)
+{
+    std::vector<float> alpha, re = {1e6f}, mach = {0.0f};
+    for (int i = 0; i <= 160; ++i) alpha.push_back(-20.0f + 0.25f * float(i));
+    if (dims >= 2) re = {1e5f, 2e5f, 5e5f, 1e6f, 2e6f, 5e6f, 1e7f, 2e7f};      // non-uniform
+    if (dims >= 3) mach = {0.0f, 0.2f, 0.4f, 0.6f, 0.8f, 1.0f};
+
+    std::vector<glm::vec3> values;
+    for (float m : mach)
+        for (float r : re)
+            for (float a : alpha) values.push_back(reference(a, r, m));
+    return PolarGrid::create(alpha, re, mach, values);
+}
+
+static std::vector<Query> makeQueries(bool coherent, size_t n, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> ua(-20.0f, 20.0f), ur(1e5f, 2e7f), um(0.0f, 1.0f);
+    std::normal_distribution<float> step(0.0f, 1.0f);
+    std::vector<Query> q(n);
+    Query cur{0.0f, 1e6f, 0.3f};
+    for (Query& x : q) {
+        if (coherent) {
+            // one aircraft's AoA/Re/Mach drifting between steps
+            cur.alpha = std::clamp(cur.alpha + 0.05f * step(rng), -20.0f, 20.0f);
+            cur.re = std::clamp(cur.re * (1.0f + 0.001f * step(rng)), 1e5f, 2e7f);
+            cur.mach = std::clamp(cur.mach + 0.0005f * step(rng), 0.0f, 1.0f);
+            x = cur;
+        } else {
+            x = {ua(rng), ur(rng), um(rng)};
+        }
+    }
+    return q;
+}
+
+int main()
+{
+    std::mt19937 rng(42);
+    const size_t N = 2000000;
+
+    std::printf("%5s %10s %12s %12s %12s\n", "dims", "queries", "no hint ns", "hint ns", "max err");
+    for (int dims = 1; dims <= 3; ++dims) {
+        auto grid = makeGrid(dims);
+        for (bool coherent : {false, true}) {
+            std::vector<Query> q = makeQueries(coherent, N, rng);
+
+            float maxErr = 0.0f;
+            for (size_t i = 0; i < N; i += 97) {
+                const Query& x = q[i];
+                glm::vec3 ref = reference(x.alpha, dims >= 2 ? x.re : 1e6f, dims >= 3 ? x.mach : 0.0f);
+                AeroCoeffs c = grid->sample(x.alpha, x.re, x.mach);
+                maxErr = std::max({maxErr, std::fabs(c.Cl - ref.x), std::fabs(c.Cd - ref.y), std::fabs(c.Cm - ref.z)});
+            }
+
+            double ns[2];
+            for (int useHint = 0; useHint < 2; ++useHint) {
+                PolarCellHint hint;
+                float sink = 0.0f;
+                auto t0 = std::chrono::steady_clock::now();
+                for (const Query& x : q) sink += grid->sample(x.alpha, x.re, x.mach, useHint ? &hint : nullptr).Cl;
+                auto t1 = std::chrono::steady_clock::now();
+                volatile float keep = sink; (void)keep;
+                ns[useHint] = std::chrono::duration<double, std::nano>(t1 - t0).count() / double(N);
+            }
+
+            std::printf("%5d %10s %12.2f %12.2f %12.2e\n", grid->dimensions(),
+                        coherent ? "coherent" : "random", ns[0], ns[1], maxErr);
+        }
+    }
+    return 0;
+}
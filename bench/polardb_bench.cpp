@@ -0,0 +1,126 @@
+// Polar database load time: 5000 synthetic airfoils (a third of them on
+// non-uniform alpha grids, so with bracket blocks) written once, then
+// PolarDatabase::open - mapping plus the full directory and bracket
+// validation - and find() by name, first / middle / last entry and every
+// entry in turn. Also checks that open rejects a database whose bracket
+// block names a missing segment or whose inv_step is not finite.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "polardb.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+static double msSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static std::vector<glm::vec4> syntheticCurve(size_t k)
+{
+    // thin-airfoil Cl with a stall roll-off; every third airfoil has a finer
+    // grid around stall, which makes the alpha grid non-uniform
+    const float slope = 0.10f + 0.001f * float(k % 17), zeroLift = -4.0f + 0.05f * float(k % 61);
+    std::vector<glm::vec4> curve;
+    for (float a = -10.0f; a <= 20.0f; a += (k % 3 == 0 && a >= 10.0f) ? 0.25f : 1.0f) {
+        float cl = slope * (a - zeroLift);
+        if (a > 14.0f) cl -= 0.08f * (a - 14.0f) * (a - 14.0f);
+        curve.push_back(glm::vec4(a, cl, 0.008f + 0.0004f * a * a, -0.05f - 0.002f * a));
+    }
+    return curve;
+}
+
+// copy of `from` with entry `i` altered by `edit`
+template <class Edit>
+static bool writeCorrupt(const char* from, const char* to, size_t i, Edit edit)
+{
+    std::FILE* f = std::fopen(from, "rb");
+    if (!f) return false;
+    std::vector<unsigned char> bytes;
+    unsigned char buf[65536];
+    size_t got;
+    while ((got = std::fread(buf, 1, sizeof(buf), f)) > 0) bytes.insert(bytes.end(), buf, buf + got);
+    std::fclose(f);
+
+    PolarDbEntry* dir = reinterpret_cast<PolarDbEntry*>(bytes.data() + sizeof(PolarDbHeader));
+    edit(dir[i], bytes.data());
+    f = std::fopen(to, "wb");
+    if (!f) return false;
+    bool ok = std::fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size();
+    return (std::fclose(f) == 0) && ok;
+}
+
+int main()
+{
+    const size_t n = 5000;
+    std::vector<PolarDbSource> airfoils(n);
+    for (size_t k = 0; k < n; ++k) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "synthetic-%05zu", k);
+        airfoils[k].name = name;
+        airfoils[k].curve = syntheticCurve(k);
+    }
+    const char* path = "polardb_bench.pdb";
+    if (!writePolarDatabase(path, airfoils)) return 1;
+
+    // open: best of a few, the file is in the page cache after the write
+    const int reps = 20;
+    double best = 1e30;
+    std::shared_ptr<const PolarDatabase> db;
+    size_t brackets = 0;
+    for (int r = 0; r < reps; ++r) {
+        db.reset();
+        auto t0 = std::chrono::steady_clock::now();
+        db = PolarDatabase::open(path);
+        best = std::min(best, msSince(t0));
+        if (!db) return 1;
+    }
+    for (size_t i = 0; i < db->size(); ++i) brackets += db->entry(i).bracketCount != 0;
+    std::printf("%zu airfoils (%zu with bracket blocks), open: %.3f ms (best of %d)\n", db->size(), brackets, best,
+                reps);
+
+    for (size_t k : {size_t(0), n / 2, n - 1}) {
+        auto t0 = std::chrono::steady_clock::now();
+        long found = db->find(airfoils[k].name);
+        std::printf("find %s: %.4f ms%s\n", airfoils[k].name.c_str(), msSince(t0), found == long(k) ? "" : "  WRONG");
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    size_t right = 0;
+    for (size_t k = 0; k < n; ++k) right += db->find(airfoils[k].name) == long(k);
+    const double all = msSince(t0);
+    std::printf("find every airfoil: %.1f ms total, %.4f ms each, %zu/%zu found\n", all, all / double(n), right, n);
+
+    // open + find + polar view, the path an application takes for one airfoil
+    db.reset();
+    t0 = std::chrono::steady_clock::now();
+    db = PolarDatabase::open(path);
+    long last = db ? db->find(airfoils[n - 1].name) : -1;
+    if (last < 0) return 1;
+    Airfoil foil = db->airfoil(size_t(last));
+    std::printf("open + find + airfoil view of the last entry: %.3f ms (Cl(5 deg) = %.3f)\n", msSince(t0),
+                foil.sample(5.0f).Cl);
+
+    // corrupt copies must be refused
+    size_t bracketed = 0;
+    while (db->entry(bracketed).bracketCount == 0) ++bracketed;
+    db.reset();
+    const char* bad = "polardb_bench_bad.pdb";
+    bool rejected = true;
+    if (!writeCorrupt(path, bad, bracketed, [](PolarDbEntry& e, unsigned char* base) {
+            reinterpret_cast<uint32_t*>(base + e.bracketOffset)[e.bracketCount / 2] = e.segmentCount;
+        })) return 1;
+    rejected &= !PolarDatabase::open(bad);
+    if (!writeCorrupt(path, bad, 1, [](PolarDbEntry& e, unsigned char*) {
+            e.inv_step = std::numeric_limits<float>::quiet_NaN();
+        })) return 1;
+    rejected &= !PolarDatabase::open(bad);
+    if (!writeCorrupt(path, bad, 2, [](PolarDbEntry& e, unsigned char*) { e.segmentCount = 0; })) return 1;
+    rejected &= !PolarDatabase::open(bad);
+    std::printf("corrupt bracket / inv_step / segment count rejected: %s\n", rejected ? "yes" : "NO");
+
+    std::remove(path);
+    std::remove(bad);
+    return rejected ? 0 : 1;
+}
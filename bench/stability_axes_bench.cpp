@@ -0,0 +1,87 @@
+// Axis check for the stability-table model: sideslip, rate and control
+// steps from level flight along +x, each compared with the same state
+// without the step. Body frame is x forward, y up, z span, so a positive
+// sideslip (relative wind from +z) must yaw the nose back about y, pitch
+// damping acts about z and yaw damping about y. Prints each case and exits
+// non-zero if a moment has the wrong sign or leaks between the lateral
+// (x, y) and pitch (z) axes, or if the airfoil's Cm is not about z.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include "builtinpolars.h"
+#include "stability.h"
+#include <cmath>
+#include <cstdio>
+
+static const float DEG2RAD = 3.14159265358979323846f / 180.0f;
+
+// angular acceleration the step adds to the level-flight state
+static glm::vec3 momentStep(Aircraft plane, glm::vec3 velocity, glm::vec3 rates, glm::vec3 controls)
+{
+    RigidState base = aircraftState(plane);
+    base.orientation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);   // wings level, nose along +x
+    base.velocity = glm::vec3(glm::length(velocity), 0.0f, 0.0f);
+    base.angularVelocity = glm::vec3(0.0f);
+    plane.controls = glm::vec3(0.0f);
+    glm::vec3 a0 = aircraftDerivative(plane, base, false, false).dAngularVelocity;
+    RigidState s = base;
+    s.velocity = velocity;
+    s.angularVelocity = rates;
+    plane.controls = controls;
+    return aircraftDerivative(plane, s, false, false).dAngularVelocity - a0;
+}
+
+static bool check(const char* name, glm::vec3 d, int axis, float sign)
+{
+    // the step's effect on `axis` has `sign`; lateral steps (roll/yaw, which
+    // couple through dihedral and cross derivatives) leave pitch alone, and
+    // pitch steps leave roll and yaw alone
+    bool ok = d[axis] * sign > 0.0f;
+    const float tiny = 1e-4f * std::fabs(d[axis]);
+    if (axis == 2) ok = ok && std::fabs(d.x) <= tiny && std::fabs(d.y) <= tiny;
+    else ok = ok && std::fabs(d.z) <= tiny;
+    std::printf("%-28s d(angular accel) = (%9.4f %9.4f %9.4f)  %s\n", name, d.x, d.y, d.z, ok ? "ok" : "WRONG");
+    return ok;
+}
+
+int main()
+{
+    Aircraft plane = createAirplane(builtinAirfoil<NACA_4412>(), {0.0f, 30.0f, 0.0f}, {15.0f, 0.0f, 0.0f},
+                                    2.0f, 0.4046f, 2.0f, 0.1524f, 0.0f, {0.05f, 0.05f, 0.05f});
+    plane.stability = defaultStabilityTable();
+    const float V = 15.0f, beta = 5.0f * DEG2RAD;
+    const glm::vec3 level(V, 0.0f, 0.0f), none(0.0f);
+    const glm::vec3 slip(V * std::cos(beta), 0.0f, V * std::sin(beta));
+
+    bool ok = true;
+    // relative wind from +z: the nose turns toward +z, a negative rotation about y
+    ok &= check("sideslip +5 deg: yaw back", momentStep(plane, slip, none, none), 1, -1.0f);
+    ok &= check("sideslip -5 deg: yaw back",
+                momentStep(plane, glm::vec3(slip.x, 0.0f, -slip.z), none, none), 1, 1.0f);
+    // damping opposes each rate about its own axis
+    ok &= check("roll rate +x: damped", momentStep(plane, level, {0.5f, 0.0f, 0.0f}, none), 0, -1.0f);
+    ok &= check("yaw rate +y: damped", momentStep(plane, level, {0.0f, 0.5f, 0.0f}, none), 1, -1.0f);
+    ok &= check("pitch rate +z: damped", momentStep(plane, level, {0.0f, 0.0f, 0.5f}, none), 2, -1.0f);
+    // controls: each on its own axis (signs are the table's)
+    ok &= check("aileron: roll", momentStep(plane, level, none, {0.1f, 0.0f, 0.0f}), 0, 1.0f);
+    ok &= check("elevator: pitch", momentStep(plane, level, none, {0.0f, 0.1f, 0.0f}), 2, -1.0f);
+    ok &= check("rudder: yaw", momentStep(plane, level, none, {0.0f, 0.0f, 0.1f}), 1, 1.0f);
+
+    // the wing's static Cm pitches about z with a table attached, so the
+    // elevator can trim it; nothing about y at wings-level, zero sideslip
+    {
+        RigidState s = aircraftState(plane);
+        s.orientation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+        s.velocity = level;
+        s.angularVelocity = none;
+        plane.controls = none;
+        const glm::vec3 a = aircraftDerivative(plane, s, false, false).dAngularVelocity;
+        const float Cm = plane.aeroTable->lookupLinear(0.0f).Cm;   // the coefficient the model flies
+        const bool pitchOk = a.z * Cm > 0.0f && std::fabs(a.y) <= 1e-4f * std::fabs(a.z);
+        std::printf("%-28s angular accel      = (%9.4f %9.4f %9.4f)  %s\n", "airfoil Cm at level flight", a.x,
+                    a.y, a.z, pitchOk ? "ok" : "WRONG");
+        ok &= pitchOk;
+    }
+
+    std::printf("%s\n", ok ? "all moments on the right axes" : "FAILED");
+    return ok ? 0 : 1;
+}
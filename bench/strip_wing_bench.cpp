@@ -0,0 +1,79 @@
+// Strip-theory wing cost: 32 strips x 1000 aircraft per step on one core,
+// kernel alone and inside updatePhysics, against the lumped-wing model and
+// a real-time budget; plus the roll damping the strips produce on their own.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include "builtinpolars.h"
+#include "stripwing.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+static std::vector<Aircraft> makeFleet(const Airfoil& foil, size_t n, int strips, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+    std::vector<Aircraft> fleet;
+    fleet.reserve(n);
+    std::shared_ptr<const StripWing> wing;
+    for (size_t i = 0; i < n; ++i) {
+        Aircraft a = createAirplane(foil, {0.0f, 500.0f, 0.0f}, {5.0f * u(rng), 0.0f, 10.0f * u(rng)},
+                                    2.0f, 0.4046f, 2.0f, 0.1524f, 10.0f, {0.05f, 0.05f, 0.05f});
+        a.velocity = {20.0f, u(rng), u(rng)};
+        a.angularVelocity = {0.5f * u(rng), 0.2f * u(rng), 0.2f * u(rng)};
+        if (strips > 0) {
+            if (!wing) wing = defaultStripWing(a, strips);   // one geometry shared by the fleet
+            a.strips = wing;
+        }
+        fleet.push_back(a);
+    }
+    return fleet;
+}
+
+template <class F>
+static double msPer(int reps, F&& f)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r) f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count() / double(reps);
+}
+
+int main()
+{
+    const size_t FLEET = 1000;
+    const int REPS = 200;
+    const double BUDGET_MS = 1000.0 / 120.0;   // 120 Hz physics
+    std::mt19937 rng(7);
+    Airfoil foil = builtinAirfoil<NACA_4412>();
+
+    std::printf("%8s %8s %16s %16s %10s\n", "strips", "fleet", "kernel ms/step", "update ms/step", "budget %");
+    for (int strips : {0, 8, 32, 64}) {
+        std::vector<Aircraft> fleet = makeFleet(foil, FLEET, strips, rng);
+
+        double kernel = 0.0;
+        if (strips > 0) {
+            float sink = 0.0f;
+            kernel = msPer(REPS, [&] {
+                for (const Aircraft& a : fleet)
+                    sink += a.strips->evaluate(a.velocity, a.angularVelocity, a.controls).moment.x;
+            });
+            volatile float keep = sink; (void)keep;
+        }
+        double update = msPer(REPS, [&] {
+            for (Aircraft& a : fleet) updatePhysics(a, 0.0f, 0.0f, 1.0f / 120.0f);
+        });
+        std::printf("%8d %8zu %16.3f %16.3f %9.1f%%\n", strips, FLEET, kernel, update, 100.0 * update / BUDGET_MS);
+    }
+
+    // roll damping and aileron authority from the strip model alone (no stability table)
+    Aircraft probe = makeFleet(foil, 1, 32, rng).front();
+    std::printf("\n%8s %8s %12s %12s\n", "p rad/s", "aileron", "roll N*m", "yaw N*m");
+    for (float p : {-2.0f, 0.0f, 2.0f}) {
+        for (float ail : {0.0f, 0.1f}) {
+            StripLoads l = probe.strips->evaluate({20.0f, -1.0f, 0.0f}, {p, 0.0f, 0.0f}, {ail, 0.0f, 0.0f});
+            std::printf("%8.1f %8.1f %12.4f %12.4f\n", p, ail, l.moment.x, l.moment.y);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+// Sweep engine throughput: a grid over mass x wing area x thrust crossed
+// with Monte-Carlo draws of the initial attitude, rates and inertia, then
+// the same grid with the wingspan and wing area drawn too (a new aspect
+// ratio, so a new coefficient table, every case); each case 2 s at 120 Hz.
+// Reports cases/s and cases/hour for 1 thread and for every core (at least
+// 4), the coefficient tables left in the shared cache, checks that both
+// results files are byte-identical and that readSweepResults round-trips
+// the spec (case parameters regenerate).
+#define GLM_ENABLE_EXPERIMENTAL
+#include "sweep.h"
+#include "builtinpolars.h"
+#include "threadpool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+static double timeSweep(unsigned threads, const Airfoil& foil, const SweepSpec& spec, const char* path)
+{
+    ThreadPool pool({threads});
+    auto t0 = std::chrono::steady_clock::now();
+    if (!runSweep(pool, foil, spec, path)) return 0.0;
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static std::vector<char> slurp(const char* path)
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static bool benchSpec(const char* name, const Airfoil& foil, const SweepSpec& spec, unsigned hw)
+{
+    const uint64_t cases = sweepCaseCount(spec);
+    std::printf("%s: %llu cases of %.1f s at %.0f Hz\n", name, (unsigned long long)cases, spec.duration,
+                1.0f / spec.dt);
+
+    double t1 = timeSweep(1, foil, spec, "sweep_bench_1.swp");
+    double tn = timeSweep(hw, foil, spec, "sweep_bench_n.swp");
+    if (t1 <= 0.0 || tn <= 0.0) return false;
+    std::printf("%8s %12s %14s\n", "threads", "cases/s", "cases/hour");
+    std::printf("%8u %12.0f %14.3e\n", 1u, double(cases) / t1, 3600.0 * double(cases) / t1);
+    std::printf("%8u %12.0f %14.3e\n", hw, double(cases) / tn, 3600.0 * double(cases) / tn);
+    std::printf("coefficient tables left in the shared cache: %zu\n", liveAeroCoeffTableCount());
+    std::printf("results files identical: %s\n", slurp("sweep_bench_1.swp") == slurp("sweep_bench_n.swp") ? "yes" : "NO");
+
+    SweepSpec back;
+    std::vector<SweepRecord> records;
+    if (!readSweepResults("sweep_bench_n.swp", back, records)) return false;
+    size_t floor = 0, diverged = 0;
+    for (const SweepRecord& r : records) {
+        floor += r.outcome == SWEEP_HIT_FLOOR;
+        diverged += r.outcome == SWEEP_DIVERGED;
+    }
+    const uint64_t probe = cases / 3;
+    bool same = sweepCase(back, probe) == sweepCase(spec, probe) && records.size() == cases &&
+                records[probe].caseIndex == probe;
+    std::printf("read back %zu records (%zu hit the floor, %zu diverged), spec round trip: %s\n\n",
+                records.size(), floor, diverged, same ? "ok" : "MISMATCH");
+    std::remove("sweep_bench_1.swp");
+    std::remove("sweep_bench_n.swp");
+    return true;
+}
+
+int main()
+{
+    Airfoil foil = builtinAirfoil<NACA_4412>();
+
+    SweepSpec spec;
+    spec.params = {
+        SweepParam::grid(SWEEP_MASS, 1.5f, 3.0f, 8),
+        SweepParam::grid(SWEEP_WING_AREA, 0.3f, 0.5f, 5),
+        SweepParam::grid(SWEEP_THRUST, 0.0f, 15.0f, 4),
+        SweepParam::normal(SWEEP_PITCH, 0.0f, 5.0f),
+        SweepParam::uniform(SWEEP_ROLL, -20.0f, 20.0f),
+        SweepParam::normal(SWEEP_PITCH_RATE, 0.0f, 0.3f),
+        SweepParam::uniform(SWEEP_IYY, 0.03f, 0.08f),
+    };
+    spec.samples = 250;
+    spec.duration = 2.0f;
+    spec.seed = 42;
+
+    SweepSpec geometry = spec;
+    geometry.params = {
+        SweepParam::grid(SWEEP_MASS, 1.5f, 3.0f, 8),
+        SweepParam::grid(SWEEP_THRUST, 0.0f, 15.0f, 4),
+        SweepParam::uniform(SWEEP_WINGSPAN, 1.6f, 2.4f),
+        SweepParam::normal(SWEEP_WING_AREA, 0.4f, 0.03f),
+        SweepParam::normal(SWEEP_PITCH, 0.0f, 5.0f),
+        SweepParam::uniform(SWEEP_ROLL, -20.0f, 20.0f),
+    };
+
+    // at least 4 participants, so the identical-file check means something on small machines
+    const unsigned hw = std::max(4u, std::thread::hardware_concurrency());
+    if (!benchSpec("grid x draws", foil, spec, hw)) return 1;
+    if (!benchSpec("drawn wing geometry", foil, geometry, hw)) return 1;
+    return 0;
+}
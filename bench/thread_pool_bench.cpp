@@ -0,0 +1,98 @@
+// Thread-pool scaling: a 1M-aircraft fleet and a 100k Aircraft array stepped
+// on 1, 2, 4, ... participants, against the serial calls. Every run must
+// leave bit-identical state, and a float sum of kinetic energy through
+// parallelReduce must print the same bits for every thread count.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include "builtinpolars.h"
+#include "fleet.h"
+#include "threadpool.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+static double secondsSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static bool sameState(const AircraftFleet& a, const AircraftFleet& b)
+{
+    const size_t bytes = a.size() * sizeof(float);
+    for (auto col : {&AircraftFleet::px, &AircraftFleet::vy, &AircraftFleet::qw, &AircraftFleet::qz, &AircraftFleet::wy})
+        if (std::memcmp((a.*col).data(), (b.*col).data(), bytes) != 0) return false;
+    return true;
+}
+
+int main()
+{
+    const size_t FLEET = 1000000, PLANES = 100000;
+    const int STEPS = 50;
+    const float dt = 0.01f;
+
+    Airfoil foil = builtinAirfoil<NACA_4412>();
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+
+    std::vector<Aircraft> planes;
+    AircraftFleet start;
+    start.reserve(FLEET);
+    for (size_t i = 0; i < FLEET; ++i) {
+        Aircraft a = createAirplane(foil, {0.0f, 500.0f, 0.0f}, {5.0f * u(rng), 0.0f, 10.0f * u(rng)},
+                                    2.0f, 0.4046f, 2.0f, 0.1524f, 10.0f, {0.05f, 0.05f, 0.05f});
+        a.velocity = {20.0f + u(rng), u(rng), u(rng)};
+        a.angularVelocity = {0.5f * u(rng), 0.2f * u(rng), 0.2f * u(rng)};
+        start.add(a);
+        if (i < PLANES) planes.push_back(a);
+    }
+
+    // serial references
+    AircraftFleet refFleet = start;
+    for (int s = 0; s < STEPS; ++s) updatePhysicsBatch(refFleet, dt, FleetKernel::Auto);
+    std::vector<Aircraft> refPlanes = planes;
+    for (int s = 0; s < STEPS; ++s) updatePhysics(refPlanes.data(), refPlanes.size(), dt);
+
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("%u hardware threads, fleet kernel %s\n", hw, fleetKernelName(fleetBestKernel()));
+    std::printf("%8s %16s %8s %16s %8s %10s %10s\n", "threads", "fleet steps/s", "speedup",
+                "Aircraft steps/s", "speedup", "identical", "sum(KE)");
+
+    double fleet1 = 0.0, planes1 = 0.0;
+    for (unsigned t = 1; t <= std::max(hw, 4u); t *= 2) {
+        ThreadPool pool({t, t <= hw, 0});
+
+        AircraftFleet fleet = start;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int s = 0; s < STEPS; ++s) updatePhysicsBatch(pool, fleet, dt, FleetKernel::Auto);
+        double fleetRate = double(FLEET) * STEPS / secondsSince(t0);
+
+        std::vector<Aircraft> ps = planes;
+        t0 = std::chrono::steady_clock::now();
+        for (int s = 0; s < STEPS; ++s) updatePhysics(pool, ps.data(), ps.size(), dt);
+        double planesRate = double(PLANES) * STEPS / secondsSince(t0);
+
+        if (t == 1) { fleet1 = fleetRate; planes1 = planesRate; }
+
+        bool same = sameState(fleet, refFleet);
+        for (size_t i = 0; i < PLANES && same; ++i)
+            same = std::memcmp(&ps[i].position, &refPlanes[i].position, sizeof(glm::vec3)) == 0 &&
+                   std::memcmp(&ps[i].orientation, &refPlanes[i].orientation, sizeof(glm::quat)) == 0;
+
+        // order-sensitive float sum: only a fixed combine order gives stable bits
+        float ke = pool.parallelReduce(FLEET, 4096, 0.0f, [&](size_t b, size_t e) {
+            float s = 0.0f;
+            for (size_t i = b; i < e; ++i)
+                s += 0.5f * fleet.mass[i] * (fleet.vx[i] * fleet.vx[i] + fleet.vy[i] * fleet.vy[i] + fleet.vz[i] * fleet.vz[i]);
+            return s;
+        }, [](float a, float b) { return a + b; });
+        uint32_t bits;
+        std::memcpy(&bits, &ke, sizeof(bits));
+
+        std::printf("%8u %16.3e %8.2f %16.3e %8.2f %10s %10.6g (%08x)\n", t, fleetRate, fleetRate / fleet1,
+                    planesRate, planesRate / planes1, same ? "yes" : "NO", ke, bits);
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Trim table across the envelope: speed x climb angle x turn rate for the
+// lumped, stability-table, strip and vortex-lattice models. Reports the
+// time for the whole table on one thread and on the pool, how many points
+// trimmed, whether one-condition batches match the lockstep batches, and
+// how well a trimmed stability-model aircraft holds its state when flown.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "trim.h"
+#include "builtinpolars.h"
+#include "stability.h"
+#include "stripwing.h"
+#include "threadpool.h"
+#include "vortexlattice.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+static double msSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static bool sameSolutions(const std::vector<TrimSolution>& a, const std::vector<TrimSolution>& b)
+{
+    for (size_t i = 0; i < a.size(); ++i)
+        if (a[i].converged != b[i].converged || std::memcmp(&a[i].alphaDeg, &b[i].alphaDeg, sizeof(float)) != 0 ||
+            std::memcmp(&a[i].thrust, &b[i].thrust, sizeof(float)) != 0)
+            return false;
+    return true;
+}
+
+int main()
+{
+    std::vector<TrimCondition> envelope;
+    for (float speed = 8.0f; speed <= 30.0f; speed += 1.0f)
+        for (float climb = -6.0f; climb <= 10.0f; climb += 2.0f)
+            for (float turn = -0.6f; turn <= 0.61f; turn += 0.2f)
+                envelope.push_back({speed, climb, turn});
+
+    Aircraft lumped = createAirplane(builtinAirfoil<NACA_4412>(), {0.0f, 30.0f, 0.0f}, {0.0f, 0.0f, 0.0f},
+                                     2.0f, 0.4046f, 2.0f, 0.1524f, 0.0f, {0.05f, 0.05f, 0.05f});
+    Aircraft stability = lumped;
+    stability.stability = defaultStabilityTable();
+    Aircraft strips = lumped;
+    strips.strips = defaultStripWing(strips, 32);
+
+    // wing + all-moving tail
+    StripSurface wing;
+    wing.span = 2.0f; wing.rootChord = 0.25f; wing.tipChord = 0.15f; wing.strips = 12; wing.aileron = 0.3f;
+    StripSurface tail;
+    tail.root = {-0.8f, 0.05f, 0.0f}; tail.span = 0.6f; tail.rootChord = tail.tipChord = 0.12f;
+    tail.strips = 4; tail.incidenceDeg = -2.0f; tail.elevator = 1.0f;
+    Aircraft lattice = lumped;
+    lattice.lattice = acquireVortexLattice({wing, tail}, 2, lumped.airfoil.properties());
+
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    ThreadPool pool({hw});
+    const size_t n = envelope.size();
+    std::printf("%zu conditions (speed 8-30 m/s, climb -6..10 deg, turn rate -0.6..0.6 rad/s), %u threads\n\n", n, hw);
+    std::printf("%-10s %10s %10s %10s %9s %12s %10s\n", "model", "1 thread", "pool", "1/batch", "trimmed",
+                "controls", "same");
+
+    struct Row { const char* name; const Aircraft* plane; };
+    for (Row row : {Row{"lumped", &lumped}, Row{"stability", &stability}, Row{"strips", &strips},
+                    Row{"lattice", &lattice}}) {
+        std::vector<TrimSolution> serial(n), parallel(n), single(n);
+
+        auto t0 = std::chrono::steady_clock::now();
+        trimAircraft(*row.plane, envelope.data(), serial.data(), n);
+        double tSerial = msSince(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        trimAircraft(pool, *row.plane, envelope.data(), parallel.data(), n);
+        double tPool = msSince(t0);
+
+        // one condition per batch: the lattice loses its batched solve
+        t0 = std::chrono::steady_clock::now();
+        trimAircraft(pool, *row.plane, envelope.data(), single.data(), n, TrimOptions(), 1);
+        double tSingle = msSince(t0);
+
+        size_t ok = size_t(std::count_if(serial.begin(), serial.end(), [](const TrimSolution& s) { return s.converged; }));
+        const glm::bvec3 c = serial[0].trimmedControls;
+        char controls[16];
+        std::snprintf(controls, sizeof(controls), "%s%s%s", c.x ? "ail " : "", c.y ? "elev " : "", c.z ? "rud" : "");
+        std::printf("%-10s %8.0f ms %7.0f ms %7.0f ms %4zu/%-4zu %12s %10s\n", row.name, tSerial, tPool, tSingle,
+                    ok, n, c.x || c.y || c.z ? controls : "-",
+                    sameSolutions(serial, parallel) && sameSolutions(serial, single) ? "yes" : "NO");
+    }
+
+    // fly a trimmed stability-model aircraft: it should stay on its path
+    TrimCondition level{15.0f, 0.0f, 0.0f};
+    TrimSolution trim = trimAircraft(stability, level);
+    Aircraft plane = stability;
+    applyTrim(plane, trim);
+    RK4 rk4;
+    for (int s = 0; s < 240; ++s) updatePhysics(plane, 1.0f / 120.0f, rk4);
+    std::printf("\nstability model trimmed at 15 m/s level (alpha %.2f deg, bank %.2f deg, thrust %.3f N, elevator "
+                "%.4f rad), after 2 s with RK4: speed %.4f m/s, altitude change %.4f m\n",
+                trim.alphaDeg, trim.bankDeg, trim.thrust, trim.controls.y, glm::length(plane.velocity),
+                plane.position.y - level.altitude);
+    return 0;
+}
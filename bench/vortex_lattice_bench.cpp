@@ -0,0 +1,85 @@
+// Vortex-lattice cost: one-time assembly + LU per geometry, then per-step
+// back-substitution, aircraft by aircraft vs batched right-hand sides; how
+// many lattices the shared cache holds once one is released; plus the lift
+// slope / span efficiency the lattice produces for a plain wing.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include "vortexlattice.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+static double msSince(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main()
+{
+    const AirfoilProperties props = paperDefaultProperties(0.01f);
+
+    // wing + horizontal tail of a small trainer
+    StripSurface wing;
+    wing.span = 2.0f; wing.rootChord = 0.25f; wing.tipChord = 0.15f; wing.strips = 24; wing.aileron = 0.3f;
+    StripSurface tail;
+    tail.root = {-0.8f, 0.05f, 0.0f}; tail.span = 0.6f; tail.rootChord = tail.tipChord = 0.12f;
+    tail.strips = 8; tail.incidenceDeg = -2.0f; tail.elevator = 1.0f;
+
+    std::printf("%10s %8s %14s\n", "chordwise", "panels", "create ms");
+    for (int nc : {1, 2, 4, 8}) {
+        auto t0 = std::chrono::steady_clock::now();
+        auto vl = VortexLattice::create({wing, tail}, nc, props);
+        std::printf("%10d %8zu %14.2f\n", nc, vl->panelCount(), msSince(t0));
+    }
+
+    // per-step cost, one geometry shared by the fleet
+    auto vl = acquireVortexLattice({wing, tail}, 4, props);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+
+    std::printf("\n%8s %8s %16s %16s %10s\n", "panels", "fleet", "single us/ac", "batched us/ac", "max diff");
+    for (size_t m : {1u, 16u, 128u, 1000u}) {
+        std::vector<glm::vec3> vel(m), omega(m), controls(m);
+        for (size_t i = 0; i < m; ++i) {
+            vel[i] = {20.0f + u(rng), u(rng), 0.5f * u(rng)};
+            omega[i] = {0.5f * u(rng), 0.2f * u(rng), 0.2f * u(rng)};
+            controls[i] = {0.05f * u(rng), 0.05f * u(rng), 0.0f};
+        }
+        std::vector<StripLoads> single(m), batched(m);
+        const int reps = int(std::max<size_t>(4, 4000 / m));
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r)
+            for (size_t i = 0; i < m; ++i) single[i] = vl->evaluate(vel[i], omega[i], controls[i]);
+        double tSingle = msSince(t0) * 1000.0 / double(reps * m);
+
+        t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r)
+            vl->evaluateBatch(vel.data(), omega.data(), controls.data(), batched.data(), m);
+        double tBatch = msSince(t0) * 1000.0 / double(reps * m);
+
+        float diff = 0.0f;
+        for (size_t i = 0; i < m; ++i)
+            diff = std::max({diff, glm::length(single[i].force - batched[i].force),
+                             glm::length(single[i].moment - batched[i].moment)});
+        std::printf("%8zu %8zu %16.2f %16.2f %10.2e\n", vl->panelCount(), m, tSingle, tBatch, diff);
+    }
+
+    // the released lattice's slot goes when the next one is factored
+    vl.reset();
+    auto coarse = acquireVortexLattice({wing, tail}, 2, props);
+    std::printf("\nlattices left in the shared cache: %zu\n", liveVortexLatticeCount());
+
+    // plain rectangular wing, AR 8: lift slope and span efficiency
+    StripSurface rect;
+    rect.span = 8.0f; rect.rootChord = rect.tipChord = 1.0f; rect.strips = 40;
+    auto plain = VortexLattice::create({rect}, 4, paperDefaultProperties(0.0f));
+    const float V = 20.0f, a = 4.0f * 3.14159265f / 180.0f, qS = 0.5f * 1.225f * V * V * 8.0f;
+    StripLoads l = plain->evaluate({V * std::cos(a), -V * std::sin(a), 0.0f}, glm::vec3(0.0f), glm::vec3(0.0f));
+    float CL = (l.force.x * std::sin(a) + l.force.y * std::cos(a)) / qS;
+    float CDi = (l.force.y * std::sin(a) - l.force.x * std::cos(a)) / qS;
+    std::printf("\nrect AR 8: CLalpha %.3f /rad, CDi %.5f, e %.3f\n", CL / a, CDi, CL * CL / (3.14159265f * 8.0f * CDi));
+    return 0;
+}
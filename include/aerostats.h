@@ -0,0 +1,67 @@
+#ifndef AEROSTATS_H
+#define AEROSTATS_H
+#include <cstdint>
+#include <iosfwd>
+
+// ---------------------------
+// Aero-path instrumentation, compiled in only with -DPHYSICS_AERO_STATS.
+//
+// Each thread counts into its own thread_local AeroStats (plain increments,
+// no atomics); blocks register themselves once per thread and fold into a
+// retired total when their thread exits. collect()/dump() sum every block,
+// so call them while the stepping threads are quiescent (between frames or
+// after a batch) - reading live counters concurrently is not synchronized.
+//
+// Without the flag AERO_STAT(...) expands to nothing and the API below is
+// a set of empty inline functions, so instrumented code costs nothing.
+// ---------------------------
+struct AeroStats {
+    static constexpr int AOA_BINS = 72;         // 5 deg bins, -180 .. +180
+    static constexpr int TABLE_BINS = 1441;     // one per AeroCoeffTable entry
+    static constexpr int SEGMENT_BINS = 256;    // Airfoil::sample segment index (clamped)
+
+    uint64_t steps = 0;             // lumped-model updatePhysics steps
+    uint64_t linear = 0;            // steps with |AoA| <= stall (paper linear branch)
+    uint64_t postStall = 0;         // steps beyond stall (flat-plate branch)
+    uint64_t liftDirFallback = 0;   // velocity parallel to the span: body-up lift
+    uint64_t paperLinear = 0;       // computeAeroCoeffsPaper branch hits (table builds, direct calls)
+    uint64_t paperPostStall = 0;
+    uint64_t polarSamples = 0;      // Airfoil::sample(alpha) calls
+
+    uint64_t aoa[AOA_BINS] = {};
+    uint64_t tableIndex[TABLE_BINS] = {};
+    uint64_t segmentIndex[SEGMENT_BINS] = {};
+
+    static int aoaBin(float aoa_deg)
+    {
+        int b = int((aoa_deg + 180.0f) * (1.0f / 5.0f));
+        return b < 0 ? 0 : (b >= AOA_BINS ? AOA_BINS - 1 : b);
+    }
+
+    void add(const AeroStats& o);
+};
+
+#ifdef PHYSICS_AERO_STATS
+
+// calling thread's counters
+AeroStats& aeroStatsLocal();
+
+// sum over live and exited threads
+AeroStats aeroStatsCollect();
+void aeroStatsReset();
+void aeroStatsDump(std::ostream& os);
+
+// AERO_STAT(++stats.steps): stmt sees the calling thread's block as `stats`
+#define AERO_STAT(stmt) do { AeroStats& stats = aeroStatsLocal(); stmt; } while (0)
+
+#else
+
+inline AeroStats aeroStatsCollect() { return AeroStats(); }
+inline void aeroStatsReset() {}
+void aeroStatsDump(std::ostream& os);   // prints a "disabled" note
+
+#define AERO_STAT(stmt) do {} while (0)
+
+#endif // PHYSICS_AERO_STATS
+
+#endif // AEROSTATS_H
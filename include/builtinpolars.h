@@ -0,0 +1,157 @@
+#ifndef BUILTINPOLARS_H
+#define BUILTINPOLARS_H
+#include "physicsengine.h"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// ---------------------------
+// Built-in polars, baked at compile time: the segment table (node values,
+// Cm from estimateCm, per-degree slopes) and the derived properties are all
+// constexpr, so built-in aircraft need no startup work and no heap for their
+// aero data. Built-in tables must be on a uniform alpha grid.
+// ---------------------------
+struct PolarRow {
+    float alpha;    // deg
+    float Cl;
+    float Cd;
+};
+
+template <size_t N>
+struct BuiltinPolar {
+    static constexpr size_t SEGMENTS = (N > 1) ? N - 1 : 1;
+
+    std::array<PolarSegment, SEGMENTS> segments;
+    float min_alpha;
+    float max_alpha;
+    float inv_step;
+    AirfoilProperties properties;   // same extraction as buildPolar
+    uint64_t hash;      // matches PolarData::hash of the same table (little-endian hosts)
+};
+
+namespace builtin_detail {
+constexpr float absf(float x) { return x < 0.0f ? -x : x; }
+
+// deliberately not constexpr: reaching it during constant evaluation is a compile error
+inline void builtinPolarMustBeUniform() {}
+
+// FNV-1a over the little-endian bytes of each float, like hashBytes in polar.cpp
+constexpr uint64_t hashFloat(uint64_t h, float f)
+{
+    uint32_t u = std::bit_cast<uint32_t>(f);
+    for (int b = 0; b < 4; ++b) {
+        h ^= (u >> (8 * b)) & 0xffu;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+} // namespace builtin_detail
+
+template <size_t N>
+constexpr BuiltinPolar<N> makeBuiltinPolar(const PolarRow (&rows)[N])
+{
+    using namespace builtin_detail;
+    BuiltinPolar<N> p{};
+    p.min_alpha = rows[0].alpha;
+    p.max_alpha = rows[N - 1].alpha;
+
+    // segments: same arithmetic as buildPolar so runtime and baked tables agree bit for bit
+    for (size_t i = 0; i < p.SEGMENTS; ++i) {
+        const PolarRow& a = rows[i];
+        const PolarRow& b = (i + 1 < N) ? rows[i + 1] : rows[i];
+        const float Cma = estimateCm(a.alpha);
+        const float Cmb = estimateCm(b.alpha);
+        float w = b.alpha - a.alpha;
+        float inv = (w > 1e-9f) ? 1.0f / w : 0.0f;
+        PolarSegment& s = p.segments[i];
+        s.alpha = a.alpha;
+        s.Cl = a.Cl; s.Cd = a.Cd; s.Cm = Cma;
+        s.dCl = (b.Cl - a.Cl) * inv;
+        s.dCd = (b.Cd - a.Cd) * inv;
+        s.dCm = (Cmb - Cma) * inv;
+        s.width = w;
+    }
+
+    if (N > 1) {
+        const float step = (p.max_alpha - p.min_alpha) / float(N - 1);
+        for (const PolarSegment& s : p.segments)
+            if (absf(s.width - step) > 1e-3f * step) builtinPolarMustBeUniform();
+        p.inv_step = 1.0f / step;
+    }
+
+    p.properties = computeAirfoilProperties(p.segments.data(), p.SEGMENTS);
+
+    uint64_t h = 1469598103934665603ull;
+    for (const PolarSegment& s : p.segments) {
+        for (float f : {s.alpha, s.Cl, s.Cd, s.Cm, s.dCl, s.dCd, s.dCm, s.width}) h = hashFloat(h, f);
+    }
+    p.hash = h;
+    return p;
+}
+
+// Airfoil backed directly by the baked table (static PolarData, no heap).
+template <const auto& P>
+Airfoil builtinAirfoil()
+{
+    static const PolarData data = [] {
+        PolarData d;
+        d.segments = P.segments.data();
+        d.segmentCount = uint32_t(P.segments.size());
+        d.min_alpha = P.min_alpha;
+        d.max_alpha = P.max_alpha;
+        d.inv_step = P.inv_step;
+        d.uniform = true;
+        d.hash = P.hash;
+        d.properties = P.properties;
+        return d;
+    }();
+    // non-owning handle: the table has static storage duration
+    return Airfoil(std::shared_ptr<const PolarData>(std::shared_ptr<const PolarData>(), &data));
+}
+
+// ---------------------------
+// NACA 4412 (alpha_deg, Cl, Cd), 0.25 deg grid
+// ---------------------------
+inline constexpr PolarRow NACA_4412_ROWS[] = {
+    {-9.500f, -0.3426f, 0.10705f}, {-9.250f, -0.3784f, 0.10671f}, {-9.000f, -0.4173f, 0.10641f},
+    {-8.750f, -0.3682f, 0.09949f}, {-8.500f, -0.3611f, 0.09726f}, {-8.250f, -0.3724f, 0.09561f},
+    {-8.000f, -0.4032f, 0.09481f}, {-7.750f, -0.4436f, 0.09403f}, {-7.500f, -0.4819f, 0.09082f},
+    {-7.250f, -0.4471f, 0.08830f}, {-7.000f, -0.4480f, 0.08640f}, {-6.750f, -0.4588f, 0.08412f},
+    {-6.500f, -0.4847f, 0.07929f}, {-6.250f, -0.4783f, 0.07718f}, {-6.000f, -0.4744f, 0.07516f},
+    {-5.750f, -0.4612f, 0.06965f}, {-5.500f, -0.4309f, 0.06730f}, {-5.250f, -0.3801f, 0.03672f},
+    {-5.000f, -0.3390f, 0.03524f}, {-4.750f, -0.2986f, 0.03253f}, {-4.500f, -0.2547f, 0.03033f},
+    {-4.250f, -0.2155f, 0.02874f}, {-4.000f, -0.1732f, 0.02773f}, {-3.750f, -0.1342f, 0.02656f},
+    {-3.500f, -0.0916f, 0.02579f}, {-3.250f, -0.0546f, 0.02511f}, {-3.000f, -0.0135f, 0.02457f},
+    {-2.750f, 0.0233f, 0.02414f}, {-2.500f, 0.0621f, 0.02363f}, {-2.250f, 0.0998f, 0.02306f},
+    {-2.000f, 0.1378f, 0.02248f}, {-1.750f, 0.1759f, 0.02179f}, {-1.500f, 0.2137f, 0.02102f},
+    {-1.250f, 0.2473f, 0.02001f}, {-1.000f, 0.3011f, 0.01877f}, {-0.750f, 0.3304f, 0.01877f},
+    {-0.500f, 0.3765f, 0.01838f}, {-0.250f, 0.4028f, 0.01841f}, { 0.000f, 0.4335f, 0.01835f},
+    { 0.250f, 0.4720f, 0.01803f}, { 0.500f, 0.4988f, 0.01808f}, { 0.750f, 0.5348f, 0.01782f},
+    { 1.000f, 0.5631f, 0.01782f}, { 1.250f, 0.5902f, 0.01789f}, { 1.500f, 0.6265f, 0.01763f},
+    { 1.750f, 0.6506f, 0.01784f}, { 2.000f, 0.6774f, 0.01798f}, { 2.250f, 0.7110f, 0.01786f},
+    { 2.500f, 0.7347f, 0.01814f}, { 2.750f, 0.7611f, 0.01836f}, { 3.000f, 0.7929f, 0.01834f},
+    { 3.250f, 0.8161f, 0.01870f}, { 3.500f, 0.8423f, 0.01895f}, { 3.750f, 0.8728f, 0.01902f},
+    { 4.000f, 0.8957f, 0.01941f}, { 4.250f, 0.9217f, 0.01970f}, { 4.500f, 0.9513f, 0.01982f},
+    { 4.750f, 0.9739f, 0.02025f}, { 5.000f, 0.9995f, 0.02057f}, { 5.250f, 1.0286f, 0.02074f},
+    { 5.500f, 1.0508f, 0.02119f}, { 5.750f, 1.0755f, 0.02148f}, { 6.000f, 1.1016f, 0.02159f},
+    { 6.250f, 1.1279f, 0.02168f}, { 6.500f, 1.1534f, 0.02184f}, { 6.750f, 1.1757f, 0.02207f},
+    { 7.000f, 1.1987f, 0.02216f}, { 7.250f, 1.2212f, 0.02223f}, { 7.500f, 1.2409f, 0.02240f},
+    { 7.750f, 1.2594f, 0.02262f}, { 8.000f, 1.2769f, 0.02285f}, { 8.250f, 1.2933f, 0.02308f},
+    { 8.500f, 1.3086f, 0.02333f}, { 8.750f, 1.3197f, 0.02372f}, { 9.000f, 1.3281f, 0.02421f},
+    { 9.250f, 1.3316f, 0.02495f}, { 9.500f, 1.3276f, 0.02605f}, { 9.750f, 1.3204f, 0.02765f},
+    {10.000f, 1.3127f, 0.02965f}, {10.250f, 1.3077f, 0.03176f}, {10.500f, 1.3074f, 0.03378f},
+    {10.750f, 1.3110f, 0.03571f}, {11.000f, 1.3189f, 0.03755f}, {11.250f, 1.3289f, 0.03922f},
+    {11.500f, 1.3439f, 0.04092f}, {11.750f, 1.3595f, 0.04250f}, {12.000f, 1.3787f, 0.04430f},
+    {12.250f, 1.3912f, 0.04604f}, {12.500f, 1.4202f, 0.04801f}, {12.750f, 1.4239f, 0.05002f},
+    {13.000f, 1.4319f, 0.05205f}, {13.250f, 1.4604f, 0.05447f}, {13.500f, 1.4540f, 0.05696f},
+    {13.750f, 1.4507f, 0.05963f}, {14.000f, 1.4512f, 0.06218f}, {14.250f, 1.4783f, 0.06519f},
+    {14.500f, 1.4597f, 0.06850f}, {14.750f, 1.4404f, 0.07234f}, {15.000f, 1.4201f, 0.07667f},
+    {15.250f, 1.3983f, 0.08150f}, {15.500f, 1.3742f, 0.08690f}, {15.750f, 1.3474f, 0.09302f},
+    {16.000f, 1.3171f, 0.10006f}, {16.250f, 1.2836f, 0.10833f}, {16.500f, 1.2473f, 0.11795f},
+    {16.750f, 1.2101f, 0.12886f}, {17.000f, 1.1753f, 0.14068f}
+};
+
+inline constexpr auto NACA_4412 = makeBuiltinPolar(NACA_4412_ROWS);
+
+#endif // BUILTINPOLARS_H
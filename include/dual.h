@@ -0,0 +1,190 @@
+#ifndef DUAL_H
+#define DUAL_H
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+// ---------------------------
+// Dual<N>: forward-mode automatic differentiation. A value and its partial
+// derivatives with respect to N seeded inputs; the operators and functions
+// below apply the chain rule, so code templated on its scalar (see
+// aircraftDerivative<S>) returns a result and all N partials in one pass.
+//
+// Comparisons look at the value only: a branch picks its side and the
+// partials are that side's (one-sided at a kink). Usable as the scalar of
+// glm::vec<3, Dual<N>> and glm::qua<Dual<N>>.
+// ---------------------------
+template <int N>
+struct Dual {
+    // partials padded to whole SSE lanes (kept zero): loops over a multiple
+    // of 4 vectorize at -O2
+    static constexpr int LANES = (N + 3) & ~3;
+
+    float v;            // value
+    float d[LANES];     // partials, d[N..] unused
+
+    // uninitialized, like a float (glm keeps its components in unions, which
+    // needs a trivial default constructor)
+    Dual() = default;
+    // constants (glm also builds scalars from int and double literals)
+    template <class A, std::enable_if_t<std::is_arithmetic_v<A>, int> = 0>
+    constexpr Dual(A value) : v(float(value)), d{} {}
+
+    // input i: value x, d/dx_i = 1
+    static Dual variable(float x, int i)
+    {
+        Dual r(x);
+        r.d[i] = 1.0f;
+        return r;
+    }
+};
+
+inline float scalarValue(float x) { return x; }
+template <int N>
+inline float scalarValue(const Dual<N>& x) { return x.v; }
+
+// ---------------------------
+// Arithmetic
+// ---------------------------
+template <int N>
+inline Dual<N> operator-(const Dual<N>& a)
+{
+    Dual<N> r;
+    r.v = -a.v;
+    for (int i = 0; i < Dual<N>::LANES; ++i) r.d[i] = -a.d[i];
+    return r;
+}
+
+template <int N>
+inline Dual<N> operator+(const Dual<N>& a, const Dual<N>& b)
+{
+    Dual<N> r;
+    r.v = a.v + b.v;
+    for (int i = 0; i < Dual<N>::LANES; ++i) r.d[i] = a.d[i] + b.d[i];
+    return r;
+}
+
+template <int N>
+inline Dual<N> operator-(const Dual<N>& a, const Dual<N>& b)
+{
+    Dual<N> r;
+    r.v = a.v - b.v;
+    for (int i = 0; i < Dual<N>::LANES; ++i) r.d[i] = a.d[i] - b.d[i];
+    return r;
+}
+
+template <int N>
+inline Dual<N> operator*(const Dual<N>& a, const Dual<N>& b)
+{
+    Dual<N> r;
+    r.v = a.v * b.v;
+    for (int i = 0; i < Dual<N>::LANES; ++i) r.d[i] = a.d[i] * b.v + a.v * b.d[i];
+    return r;
+}
+
+template <int N>
+inline Dual<N> operator/(const Dual<N>& a, const Dual<N>& b)
+{
+    Dual<N> r;
+    r.v = a.v / b.v;
+    const float inv = 1.0f / b.v;
+    for (int i = 0; i < Dual<N>::LANES; ++i) r.d[i] = (a.d[i] - r.v * b.d[i]) * inv;
+    return r;
+}
+
+// with constants: no partials to combine
+template <int N>
+inline Dual<N> operator+(Dual<N> a, float b) { a.v += b; return a; }
+template <int N>
+inline Dual<N> operator+(float a, Dual<N> b) { b.v += a; return b; }
+template <int N>
+inline Dual<N> operator-(Dual<N> a, float b) { a.v -= b; return a; }
+template <int N>
+inline Dual<N> operator-(float a, const Dual<N>& b) { Dual<N> r = -b; r.v += a; return r; }
+
+template <int N>
+inline Dual<N> operator*(Dual<N> a, float b)
+{
+    a.v *= b;
+    for (int i = 0; i < Dual<N>::LANES; ++i) a.d[i] *= b;
+    return a;
+}
+
+template <int N>
+inline Dual<N> operator*(float a, const Dual<N>& b) { return b * a; }
+template <int N>
+inline Dual<N> operator/(const Dual<N>& a, float b) { return a * (1.0f / b); }
+template <int N>
+inline Dual<N> operator/(float a, const Dual<N>& b) { return Dual<N>(a) / b; }
+
+template <int N, class B>
+inline Dual<N>& operator+=(Dual<N>& a, const B& b) { return a = a + b; }
+template <int N, class B>
+inline Dual<N>& operator-=(Dual<N>& a, const B& b) { return a = a - b; }
+template <int N, class B>
+inline Dual<N>& operator*=(Dual<N>& a, const B& b) { return a = a * b; }
+template <int N, class B>
+inline Dual<N>& operator/=(Dual<N>& a, const B& b) { return a = a / b; }
+
+// ---------------------------
+// Comparisons (value only)
+// ---------------------------
+template <int N> inline bool operator<(const Dual<N>& a, const Dual<N>& b) { return a.v < b.v; }
+template <int N> inline bool operator>(const Dual<N>& a, const Dual<N>& b) { return a.v > b.v; }
+template <int N> inline bool operator<=(const Dual<N>& a, const Dual<N>& b) { return a.v <= b.v; }
+template <int N> inline bool operator>=(const Dual<N>& a, const Dual<N>& b) { return a.v >= b.v; }
+template <int N> inline bool operator==(const Dual<N>& a, const Dual<N>& b) { return a.v == b.v; }
+template <int N> inline bool operator!=(const Dual<N>& a, const Dual<N>& b) { return a.v != b.v; }
+template <int N> inline bool operator<(const Dual<N>& a, float b) { return a.v < b; }
+template <int N> inline bool operator>(const Dual<N>& a, float b) { return a.v > b; }
+template <int N> inline bool operator<=(const Dual<N>& a, float b) { return a.v <= b; }
+template <int N> inline bool operator>=(const Dual<N>& a, float b) { return a.v >= b; }
+template <int N> inline bool operator<(float a, const Dual<N>& b) { return a < b.v; }
+template <int N> inline bool operator>(float a, const Dual<N>& b) { return a > b.v; }
+
+// ---------------------------
+// Functions: f(a) with partials f'(a) * da
+// ---------------------------
+template <int N>
+inline Dual<N> chain(const Dual<N>& a, float value, float slope)
+{
+    Dual<N> r;
+    r.v = value;
+    for (int i = 0; i < Dual<N>::LANES; ++i) r.d[i] = slope * a.d[i];
+    return r;
+}
+
+template <int N>
+inline Dual<N> sqrt(const Dual<N>& a)
+{
+    float s = std::sqrt(a.v);
+    return chain(a, s, (s > 0.0f) ? 0.5f / s : 0.0f);
+}
+
+template <int N>
+inline Dual<N> sin(const Dual<N>& a) { return chain(a, std::sin(a.v), std::cos(a.v)); }
+template <int N>
+inline Dual<N> cos(const Dual<N>& a) { return chain(a, std::cos(a.v), -std::sin(a.v)); }
+template <int N>
+inline Dual<N> fabs(const Dual<N>& a) { return (a.v < 0.0f) ? -a : a; }
+template <int N>
+inline Dual<N> abs(const Dual<N>& a) { return fabs(a); }
+
+template <int N>
+inline Dual<N> atan2(const Dual<N>& y, const Dual<N>& x)
+{
+    Dual<N> r;
+    r.v = std::atan2(y.v, x.v);
+    const float r2 = x.v * x.v + y.v * y.v;
+    const float inv = (r2 > 0.0f) ? 1.0f / r2 : 0.0f;
+    for (int i = 0; i < Dual<N>::LANES; ++i) r.d[i] = (x.v * y.d[i] - y.v * x.d[i]) * inv;
+    return r;
+}
+
+// glm checks numeric_limits<T> on its scalar
+namespace std {
+template <int N>
+struct numeric_limits<Dual<N>> : numeric_limits<float> {};
+}
+
+#endif // DUAL_H
@@ -0,0 +1,109 @@
+#ifndef FLEET_H
+#define FLEET_H
+#include "physicsengine.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+// ---------------------------
+// Cache-line aligned storage for the fleet's SoA columns
+// ---------------------------
+template <class T, size_t Align = 64>
+struct AlignedAllocator {
+    using value_type = T;
+
+    AlignedAllocator() = default;
+    template <class U>
+    AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align))); }
+    void deallocate(T* p, size_t) { ::operator delete(p, std::align_val_t(Align)); }
+
+    template <class U>
+    struct rebind { using other = AlignedAllocator<U, Align>; };
+
+    bool operator==(const AlignedAllocator&) const { return true; }
+    bool operator!=(const AlignedAllocator&) const { return false; }
+};
+
+template <class T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+// ---------------------------
+// AircraftFleet: the state updatePhysics integrates, one aligned column per
+// scalar, for stepping many aircraft of the lumped model at once. Aero data
+// is shared per type (one AeroCoeffTable per wing/airfoil combination), so
+// a fleet of identical aircraft touches a single table.
+//
+// Only the lumped model is stored: aircraft with a stability table, strip
+// wing or vortex lattice are rejected by add() and stay on Aircraft.
+// ---------------------------
+struct AircraftFleet {
+    struct Type {
+        std::shared_ptr<const AeroCoeffTable> table;
+        float stallDeg;
+    };
+
+    // state
+    AlignedVector<float> px, py, pz;            // position (world)
+    AlignedVector<float> vx, vy, vz;            // velocity (world)
+    AlignedVector<float> qw, qx, qy, qz;        // orientation (body to world)
+    AlignedVector<float> wx, wy, wz;            // angular velocity (body)
+
+    // parameters
+    AlignedVector<float> mass;
+    AlignedVector<float> Ixx, Iyy, Izz;         // principal inertia
+    AlignedVector<float> IxxInv, IyyInv, IzzInv;
+    AlignedVector<float> wingArea, wingspan, chord;
+    AlignedVector<float> thrust;
+    AlignedVector<uint32_t> type;               // index into types
+
+    std::vector<Type> types;
+    // types' tables packed for the vector kernels: per type,
+    // AeroCoeffTable::SIZE entries of (Cl, Cd, Cm, 0)
+    AlignedVector<float> coeffs;
+
+    size_t size() const { return px.size(); }
+    void reserve(size_t n);
+
+    // index of the new aircraft, or -1 (with a message on stderr) for
+    // aircraft the fleet cannot represent
+    long add(const Aircraft& plane);
+
+    // copy aircraft i's state back into plane (parameters are left alone)
+    void read(size_t i, Aircraft& plane) const;
+};
+
+// ---------------------------
+// Batched update
+//
+// Scalar, the default, repeats the per-aircraft lumped path exactly. The
+// vector kernels step 4 (SSE), 8 (AVX2) or 16 (AVX-512) aircraft at a time
+// with a polynomial atan2, rsqrt+Newton normalization and one body->world
+// rotation for the summed force. Per step that is float noise, but an AoA
+// within rounding of a quarter-degree boundary can land in the
+// neighbouring table entry, and a lane that does keeps diverging: after 2 s
+// of fleet_simd_bench most lanes are within 5e-3 m/s of Scalar and the
+// worst is about 4 m/s apart. So they are opt-in, for throughput runs that
+// can live with that. Auto picks the widest kernel the CPU supports; asking
+// for one it lacks also falls back to that.
+// ---------------------------
+enum class FleetKernel { Auto, Scalar, SSE, AVX2, AVX512 };
+
+bool fleetKernelSupported(FleetKernel kernel);
+FleetKernel fleetBestKernel();
+const char* fleetKernelName(FleetKernel kernel);
+
+// One updatePhysics step for every aircraft in the fleet
+void updatePhysicsBatch(AircraftFleet& fleet, float dt, FleetKernel kernel = FleetKernel::Scalar);
+
+// Same, in chunks of `chunk` aircraft over the pool. chunk is rounded up to
+// a multiple of 16 so every chunk starts on a cache line and runs whole
+// vector blocks; the result is identical to the serial call.
+class ThreadPool;
+void updatePhysicsBatch(ThreadPool& pool, AircraftFleet& fleet, float dt,
+                        FleetKernel kernel = FleetKernel::Scalar, size_t chunk = 4096);
+
+#endif // FLEET_H
@@ -8,6 +8,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/quaternion.hpp>
+#include "simthread.h"
 
 enum GridHalf {
     HALF_NONE,
@@ -63,5 +64,15 @@ void renderFrame(GLFWwindow* window,
                  const glm::vec3& pos,
                  const glm::quat& orientation);
 
+// Draws the pose between two sim states (see SimThread::latest)
+void renderFrame(GLFWwindow* window,
+                 GLuint planeVAO,
+                 GLuint edgeVAO,
+                 GLuint gridVAO,
+                 GLuint gridYZVAO,
+                 const SimState& prev,
+                 const SimState& curr,
+                 float alpha);
+
 #endif
 
@@ -0,0 +1,303 @@
+#ifndef INTEGRATORS_H
+#define INTEGRATORS_H
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <algorithm>
+#include <cmath>
+
+// ---------------------------
+// Rigid-body state and its time derivative, on a scalar S: float, or a
+// Dual<N> (dual.h) when derivatives are carried along
+// ---------------------------
+template <class S>
+struct RigidStateOf {
+    glm::vec<3, S> position = glm::vec<3, S>(0.0f);         // world
+    glm::vec<3, S> velocity = glm::vec<3, S>(0.0f);         // world
+    glm::qua<S> orientation = glm::qua<S>(1.0f, 0.0f, 0.0f, 0.0f);  // body -> world
+    glm::vec<3, S> angularVelocity = glm::vec<3, S>(0.0f);  // body
+};
+
+template <class S>
+struct RigidDerivativeOf {
+    glm::vec<3, S> dPosition = glm::vec<3, S>(0.0f);
+    glm::vec<3, S> dVelocity = glm::vec<3, S>(0.0f);
+    glm::qua<S> dOrientation = glm::qua<S>(0.0f, 0.0f, 0.0f, 0.0f);  // 0.5 q (0, w)
+    glm::vec<3, S> dAngularVelocity = glm::vec<3, S>(0.0f);
+};
+
+using RigidState = RigidStateOf<float>;
+using RigidDerivative = RigidDerivativeOf<float>;
+
+// q' = 0.5 q (0, w), w in body axes
+template <class S>
+inline glm::qua<S> orientationRate(const glm::qua<S>& q, const glm::vec<3, S>& w)
+{
+    return S(0.5f) * (q * glm::qua<S>(S(0.0f), w.x, w.y, w.z));
+}
+
+// exp((0, theta) / 2): rotation by |theta| about theta (body axes)
+inline glm::quat rotationQuat(const glm::vec3& theta)
+{
+    float angle = glm::length(theta);
+    if (angle < 1e-8f) return glm::normalize(glm::quat(1.0f, 0.5f * theta.x, 0.5f * theta.y, 0.5f * theta.z));
+    float half = 0.5f * angle;
+    return glm::quat(std::cos(half), theta * (std::sin(half) / angle));
+}
+
+// q rotated by body rate w held for h: q exp(w h / 2)
+inline glm::quat rotateByRate(const glm::quat& q, const glm::vec3& w, float h)
+{
+    if (glm::length(w) * h < 1e-8f) return glm::normalize(q + orientationRate(q, w) * h);
+    return glm::normalize(q * rotationQuat(w * h));
+}
+
+// ---------------------------
+// Orientation update over one step, from the body rates at its start (w0)
+// and end (w1). Selectable per body (Aircraft::orientationUpdate):
+//   Linear  q + q' h, renormalized; q' from w1. The historical update: the
+//           length error grows with (|w| h)^2 and renormalizing shortens the
+//           rotation, so fast rolls lag at large steps.
+//   ExpMap  q exp(w1 h / 2): exact for a constant rate at any step size.
+//   Magnus  q exp(theta / 2) with the fourth-order Magnus vector for a rate
+//           varying linearly from w0 to w1,
+//           theta = h (w0 + w1) / 2 + h^2 / 12 (w0 x w1);
+//           the cross term carries the coning the other two miss when the
+//           rotation axis itself moves during the step.
+// ---------------------------
+enum class OrientationUpdate { Linear, ExpMap, Magnus };
+
+inline glm::quat advanceOrientation(const glm::quat& q, const glm::vec3& w0, const glm::vec3& w1, float h,
+                                    OrientationUpdate mode)
+{
+    switch (mode) {
+    case OrientationUpdate::ExpMap:
+        return glm::normalize(q * rotationQuat(w1 * h));
+    case OrientationUpdate::Magnus:
+        return glm::normalize(q * rotationQuat((0.5f * h) * (w0 + w1) + (h * h / 12.0f) * glm::cross(w0, w1)));
+    case OrientationUpdate::Linear:
+    default:
+        return glm::normalize(q + orientationRate(q, w1) * h);
+    }
+}
+
+// s + h * sum(c_i k_i): the stage states of the Runge-Kutta methods
+// (orientation renormalized so loads see a proper rotation)
+inline RigidState rigidAdvance(const RigidState& s, float h, const RigidDerivative& k)
+{
+    RigidState r;
+    r.position = s.position + k.dPosition * h;
+    r.velocity = s.velocity + k.dVelocity * h;
+    r.orientation = glm::normalize(s.orientation + k.dOrientation * h);
+    r.angularVelocity = s.angularVelocity + k.dAngularVelocity * h;
+    return r;
+}
+
+inline RigidDerivative operator*(float c, const RigidDerivative& k)
+{
+    return {k.dPosition * c, k.dVelocity * c, k.dOrientation * c, k.dAngularVelocity * c};
+}
+
+inline RigidDerivative operator+(const RigidDerivative& a, const RigidDerivative& b)
+{
+    return {a.dPosition + b.dPosition, a.dVelocity + b.dVelocity,
+            a.dOrientation + b.dOrientation, a.dAngularVelocity + b.dAngularVelocity};
+}
+
+// ---------------------------
+// Integrator policies
+//
+// step(f, s, dt) advances s by dt, where f(const RigidState&) returns the
+// RigidDerivative at a state. quantizeAoA selects the legacy lookup
+// (AoA rounded to the table's quarter degree); the higher-order methods
+// interpolate instead, since rounding makes the forces piecewise constant
+// in the state and caps every method at first order.
+// ---------------------------
+
+// Semi-implicit (symplectic) Euler: what updatePhysics has always done.
+// v += a dt, x += v dt, w += dw dt, then q from the old and new rates
+// (rotation; Linear is q += 0.5 q (0, w_new) dt).
+struct SemiImplicitEuler {
+    static constexpr bool quantizeAoA = true;
+    static constexpr const char* name = "semi-implicit Euler";
+
+    OrientationUpdate rotation = OrientationUpdate::Linear;
+
+    template <class F>
+    void step(F&& f, RigidState& s, float dt)
+    {
+        RigidDerivative d = f(s);
+        glm::vec3 w0 = s.angularVelocity;
+        s.velocity += d.dVelocity * dt;
+        s.position += s.velocity * dt;
+        s.angularVelocity += d.dAngularVelocity * dt;
+        s.orientation = advanceOrientation(s.orientation, w0, s.angularVelocity, dt, rotation);
+    }
+};
+
+// Velocity Verlet, with the end-of-step rates (which the aero loads depend
+// on) predicted by an Euler step; orientation follows the half-step rate
+// through the exponential map. Second order, two evaluations per step.
+struct VelocityVerlet {
+    static constexpr bool quantizeAoA = false;
+    static constexpr const char* name = "velocity Verlet";
+
+    template <class F>
+    void step(F&& f, RigidState& s, float dt)
+    {
+        RigidDerivative d0 = f(s);
+        glm::vec3 vHalf = s.velocity + d0.dVelocity * (0.5f * dt);
+        glm::vec3 wHalf = s.angularVelocity + d0.dAngularVelocity * (0.5f * dt);
+
+        RigidState p;
+        p.position = s.position + vHalf * dt;
+        p.orientation = rotateByRate(s.orientation, wHalf, dt);
+        p.velocity = s.velocity + d0.dVelocity * dt;
+        p.angularVelocity = s.angularVelocity + d0.dAngularVelocity * dt;
+        RigidDerivative d1 = f(p);
+
+        s.position = p.position;
+        s.orientation = p.orientation;
+        s.velocity = vHalf + d1.dVelocity * (0.5f * dt);
+        s.angularVelocity = wHalf + d1.dAngularVelocity * (0.5f * dt);
+    }
+};
+
+// theta' for q = q0 exp(theta / 2) under body rate w (inverse of the
+// derivative of the exponential map, truncated after the fourth-order term)
+inline glm::vec3 dexpInv(const glm::vec3& theta, const glm::vec3& w)
+{
+    return w + 0.5f * glm::cross(theta, w) + (1.0f / 12.0f) * glm::cross(theta, glm::cross(theta, w));
+}
+
+// Classic fourth-order Runge-Kutta, four evaluations per step. With rotation
+// ExpMap or Magnus it runs as RKMK (Runge-Kutta-Munthe-Kaas): the stages
+// integrate the rotation vector theta instead of adding to the quaternion,
+// and each stage orientation is q0 exp(theta / 2), so the update stays on
+// the unit sphere however far the body turns in one step.
+struct RK4 {
+    static constexpr bool quantizeAoA = false;
+    static constexpr const char* name = "RK4";
+
+    OrientationUpdate rotation = OrientationUpdate::Linear;
+
+    template <class F>
+    void step(F&& f, RigidState& s, float dt)
+    {
+        if (rotation != OrientationUpdate::Linear) {
+            stepMuntheKaas(f, s, dt);
+            return;
+        }
+        RigidDerivative k1 = f(s);
+        RigidDerivative k2 = f(rigidAdvance(s, 0.5f * dt, k1));
+        RigidDerivative k3 = f(rigidAdvance(s, 0.5f * dt, k2));
+        RigidDerivative k4 = f(rigidAdvance(s, dt, k3));
+        s = rigidAdvance(s, dt / 6.0f, k1 + 2.0f * k2 + 2.0f * k3 + k4);
+    }
+
+private:
+    template <class F>
+    void stepMuntheKaas(F& f, RigidState& s, float dt)
+    {
+        // stage state at s + h k (translation, rates) and rotation vector theta
+        auto stage = [&](float h, const RigidDerivative& k, const glm::vec3& theta) {
+            RigidState r = rigidAdvance(s, h, k);
+            r.orientation = glm::normalize(s.orientation * rotationQuat(theta));
+            return r;
+        };
+        RigidDerivative k1 = f(s);
+        glm::vec3 t1 = s.angularVelocity;
+        glm::vec3 th2 = (0.5f * dt) * t1;
+        RigidDerivative k2 = f(stage(0.5f * dt, k1, th2));
+        glm::vec3 t2 = dexpInv(th2, s.angularVelocity + k1.dAngularVelocity * (0.5f * dt));
+        glm::vec3 th3 = (0.5f * dt) * t2;
+        RigidDerivative k3 = f(stage(0.5f * dt, k2, th3));
+        glm::vec3 t3 = dexpInv(th3, s.angularVelocity + k2.dAngularVelocity * (0.5f * dt));
+        glm::vec3 th4 = dt * t3;
+        RigidDerivative k4 = f(stage(dt, k3, th4));
+        glm::vec3 t4 = dexpInv(th4, s.angularVelocity + k3.dAngularVelocity * dt);
+        s = stage(dt / 6.0f, k1 + 2.0f * k2 + 2.0f * k3 + k4, (dt / 6.0f) * (t1 + 2.0f * t2 + 2.0f * t3 + t4));
+    }
+};
+
+// Dormand-Prince 5(4) with error control. The step advances by exactly dt
+// in as many accepted substeps as the tolerance needs; the last accepted
+// substep size carries over to the next call, so keep one instance per
+// body (updatePhysics(plane, dt, integrator)).
+struct RK45 {
+    static constexpr bool quantizeAoA = false;
+    static constexpr const char* name = "RK45";
+
+    float absTol = 1e-4f;
+    float relTol = 1e-4f;
+    float minStep = 1e-5f;      // accepted regardless of error below this
+    int maxSubsteps = 1000;
+
+    float h = 0.0f;             // next substep size (0 = start with dt)
+    int accepted = 0;           // counters since construction
+    int rejected = 0;
+
+    template <class F>
+    void step(F&& f, RigidState& s, float dt)
+    {
+        float t = 0.0f;
+        if (h <= 0.0f) h = dt;
+        RigidDerivative k1 = f(s);
+        for (int n = 0; n < maxSubsteps && dt - t > 1e-6f * dt; ++n) {
+            float hs = std::min(h, dt - t);
+            RigidDerivative k2 = f(rigidAdvance(s, hs, (1.0f / 5.0f) * k1));
+            RigidDerivative k3 = f(rigidAdvance(s, hs, (3.0f / 40.0f) * k1 + (9.0f / 40.0f) * k2));
+            RigidDerivative k4 = f(rigidAdvance(s, hs, (44.0f / 45.0f) * k1 + (-56.0f / 15.0f) * k2 + (32.0f / 9.0f) * k3));
+            RigidDerivative k5 = f(rigidAdvance(s, hs, (19372.0f / 6561.0f) * k1 + (-25360.0f / 2187.0f) * k2 +
+                                                       (64448.0f / 6561.0f) * k3 + (-212.0f / 729.0f) * k4));
+            RigidDerivative k6 = f(rigidAdvance(s, hs, (9017.0f / 3168.0f) * k1 + (-355.0f / 33.0f) * k2 +
+                                                       (46732.0f / 5247.0f) * k3 + (49.0f / 176.0f) * k4 +
+                                                       (-5103.0f / 18656.0f) * k5));
+            RigidDerivative sum5 = (35.0f / 384.0f) * k1 + (500.0f / 1113.0f) * k3 + (125.0f / 192.0f) * k4 +
+                                   (-2187.0f / 6784.0f) * k5 + (11.0f / 84.0f) * k6;
+            RigidState y = rigidAdvance(s, hs, sum5);
+            RigidDerivative k7 = f(y);
+
+            // 5th minus embedded 4th order solution
+            RigidDerivative e = (71.0f / 57600.0f) * k1 + (-71.0f / 16695.0f) * k3 + (71.0f / 1920.0f) * k4 +
+                                (-17253.0f / 339200.0f) * k5 + (22.0f / 525.0f) * k6 + (-1.0f / 40.0f) * k7;
+            float err = errorNorm(s, y, e, hs);
+
+            bool accept = err <= 1.0f || hs <= minStep;
+            if (accept) {
+                s = y;
+                k1 = k7;                    // first same as last
+                t += hs;
+                ++accepted;
+            } else {
+                ++rejected;
+            }
+            float scale = err > 0.0f ? 0.9f * std::pow(err, -0.2f) : 5.0f;
+            float next = std::max(minStep, hs * std::clamp(scale, 0.2f, 5.0f));
+            // a substep clipped to the end of dt says nothing against the longer h
+            if (accept && hs < h) next = std::max(next, h);
+            h = next;
+        }
+    }
+
+private:
+    // max over components of |error| / (absTol + relTol |value|)
+    float errorNorm(const RigidState& s, const RigidState& y, const RigidDerivative& e, float hs) const
+    {
+        float m = 0.0f;
+        auto acc = [&](float err, float a, float b) {
+            m = std::max(m, std::fabs(err * hs) / (absTol + relTol * std::max(std::fabs(a), std::fabs(b))));
+        };
+        for (int i = 0; i < 3; ++i) {
+            acc(e.dPosition[i], s.position[i], y.position[i]);
+            acc(e.dVelocity[i], s.velocity[i], y.velocity[i]);
+            acc(e.dAngularVelocity[i], s.angularVelocity[i], y.angularVelocity[i]);
+        }
+        acc(e.dOrientation.w, s.orientation.w, y.orientation.w);
+        acc(e.dOrientation.x, s.orientation.x, y.orientation.x);
+        acc(e.dOrientation.y, s.orientation.y, y.orientation.y);
+        acc(e.dOrientation.z, s.orientation.z, y.orientation.z);
+        return m;
+    }
+};
+
+#endif // INTEGRATORS_H
@@ -0,0 +1,101 @@
+#ifndef LINEARIZE_H
+#define LINEARIZE_H
+#include "physicsengine.h"
+#include "fleet.h"
+#include <cstddef>
+#include <cstdint>
+
+class ThreadPool;
+
+// ---------------------------
+// Linear model about a flight state
+//
+//   x' = f0 + A (x - x0) + B (u - u0)
+//
+// x is the 13-vector of aircraftJacobian (position, velocity, orientation
+// w x y z, body rates) and u = (thrust, aileron, elevator, rudder). The
+// lumped and stability-table models are differentiated exactly (dual
+// numbers); strips and lattice by central differences. AoA is interpolated,
+// not rounded, so the model is the slope updatePhysics follows on average.
+//
+// f0 is kept: about a trim point it is the steady motion (the position
+// moving at x0's velocity, a turn's heading rate), elsewhere it is what
+// pulls the aircraft off the point.
+// ---------------------------
+struct LinearModel {
+    RigidState state;                   // x0
+    float thrust = 0.0f;                // u0
+    glm::vec3 controls = glm::vec3(0.0f);
+    AircraftJacobian jacobian;          // f0, A, B
+    bool exact = false;                 // dual numbers, not differences
+};
+
+// About plane's state, thrust and controls.
+void linearizeAircraft(Aircraft& plane, LinearModel& out);
+
+// Exact zero-order-hold discretization for step dt (the matrix exponential
+// of [A B f0] dt): over one step with the inputs held,
+//
+//   dx[k+1] = Phi dx[k] + Gamma du + c,    dx = x - x0, du = u - u0
+//
+// false (with a message on stderr) for dt <= 0 or a non-finite model.
+struct DiscreteLinearModel {
+    float dt = 0.0f;
+    float Phi[AIRCRAFT_STATE_SIZE][AIRCRAFT_STATE_SIZE];
+    float Gamma[AIRCRAFT_STATE_SIZE][AIRCRAFT_INPUT_SIZE];
+    float c[AIRCRAFT_STATE_SIZE];
+};
+
+bool discretizeLinearModel(const LinearModel& model, float dt, DiscreteLinearModel& out);
+
+// ---------------------------
+// LtiFleet: many aircraft stepped on one discrete linear model, one aligned
+// column per deviation coordinate. A step is a 13 x 17 mat-vec per
+// aircraft, run as broadcast multiply-adds over a tile of aircraft that
+// stays in L1 for all the steps of a call.
+//
+// Drift: an aircraft whose deviation leaves the limits has left the region
+// the model describes. It is frozen where it crossed (its deviation stops
+// advancing), flagged, and its stepsTaken says how far it got - read it
+// back and continue with updatePhysics for the rest. Position is not
+// checked: nothing in the loads depends on it.
+// ---------------------------
+struct LtiLimits {
+    float speed = 1.0f;         // |velocity - x0's|, m/s
+    float attitude = 0.05f;     // 2 |q - q0|, about the rotation angle from x0, rad
+    float rate = 0.2f;          // |body rates - x0's|, rad/s
+};
+
+struct LtiFleet {
+    LinearModel model;
+    DiscreteLinearModel discrete;
+    LtiLimits limits;
+
+    AlignedVector<float> dx[AIRCRAFT_STATE_SIZE];   // x - x0
+    AlignedVector<float> du[AIRCRAFT_INPUT_SIZE];   // u - u0, held
+    AlignedVector<uint8_t> drifted;
+    AlignedVector<uint32_t> stepsTaken;             // linear steps since add()
+
+    // false (with a message on stderr) if the model cannot be discretized at dt
+    bool init(const LinearModel& m, float dt, const LtiLimits& l = LtiLimits());
+
+    size_t size() const { return drifted.size(); }
+    void reserve(size_t n);
+
+    // plane's state, thrust and controls as a deviation from the model's
+    // point; returns its index
+    size_t add(const Aircraft& plane);
+
+    // x0 + dx (orientation renormalized) and u0 + du onto plane
+    void read(size_t i, Aircraft& plane) const;
+};
+
+// steps linear steps for every aircraft not yet drifted; returns how many
+// drifted during this call
+size_t propagateLti(LtiFleet& fleet, int steps);
+
+// Same, in chunks of `chunk` aircraft over the pool (rounded up to a
+// multiple of 16); the result is identical to the serial call.
+size_t propagateLti(ThreadPool& pool, LtiFleet& fleet, int steps, size_t chunk = 4096);
+
+#endif // LINEARIZE_H
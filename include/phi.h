@@ -112,6 +112,21 @@ constexpr inline float inverse_lerp(T a, T b, T v)
   return (v - a) / (b - a);
 }
 
+// rotation quaternion exp((0, theta) / 2): |theta| radians about theta
+inline glm::quat rotation_exp(const glm::vec3& theta)
+{
+  float angle = glm::length(theta);
+  if (angle < EPSILON) return glm::normalize(glm::quat(1.0f, 0.5f * theta));
+  return glm::quat(std::cos(0.5f * angle), theta * (std::sin(0.5f * angle) / angle));
+}
+
+// how RigidBody::update() advances the rotation from the body angular velocity
+enum class RotationIntegration {
+  linear,       // q += 0.5 q w dt, renormalized; lags at high rates and large dt
+  exponential,  // q = q exp(w dt / 2), exact for a constant angular velocity
+  magnus,       // q = q exp(theta / 2), theta = dt (w0 + w1) / 2 + dt^2 / 12 (w0 x w1)
+};
+
 struct Transform {
   glm::vec3 position;
   glm::quat rotation;
@@ -281,6 +296,7 @@ struct RigidBodyParams {
   glm::vec3 angular_velocity = glm::vec3(0);
   bool apply_gravity = true;
   Collider* collider = nullptr;
+  RotationIntegration rotation_integration = RotationIntegration::linear;
 };
 
 class RigidBody : public Transform
@@ -299,6 +315,7 @@ class RigidBody : public Transform
   Collider* collider = nullptr;
   glm::mat3 inertia = glm::mat3(0.0f);
   glm::mat3 inverse_inertia = glm::mat3(0.0f);  // inertia tensor
+  RotationIntegration rotation_integration = RotationIntegration::linear;
 
   RigidBody() : RigidBody({DEFAULT_RB_MASS, DEFAULT_RB_INERTIA}) {}
 
@@ -310,7 +327,8 @@ class RigidBody : public Transform
         apply_gravity(params.apply_gravity),
         angular_velocity(params.angular_velocity),
         inverse_inertia(glm::inverse(params.inertia)),
-        collider(params.collider)
+        collider(params.collider),
+        rotation_integration(params.rotation_integration)
   {
   }
 
@@ -392,9 +410,24 @@ class RigidBody : public Transform
     velocity += acceleration * dt;
     position += velocity * dt;
 
+    glm::vec3 w0 = angular_velocity;
     angular_velocity += inverse_inertia * (m_torque - glm::cross(angular_velocity, inertia * angular_velocity)) * dt;
-    rotation += (rotation * glm::quat(0.0f, angular_velocity)) * (0.5f * dt);
-    rotation = glm::normalize(rotation);
+
+    switch (rotation_integration) {
+      case RotationIntegration::exponential:
+        rotation = glm::normalize(rotation * rotation_exp(angular_velocity * dt));
+        break;
+      case RotationIntegration::magnus: {
+        glm::vec3 theta = (0.5f * dt) * (w0 + angular_velocity) + (sq(dt) / 12.0f) * glm::cross(w0, angular_velocity);
+        rotation = glm::normalize(rotation * rotation_exp(theta));
+        break;
+      }
+      case RotationIntegration::linear:
+      default:
+        rotation += (rotation * glm::quat(0.0f, angular_velocity)) * (0.5f * dt);
+        rotation = glm::normalize(rotation);
+        break;
+    }
 
     // reset accumulators
     m_force = glm::vec3(0.0f), m_torque = glm::vec3(0.0f);
@@ -3,6 +3,14 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
+#include "polargrid.h"
+#include "stability.h"
+#include "stripwing.h"
+#include "vortexlattice.h"
+#include "integrators.h"
+#include "dual.h"
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 // ---------------------------
@@ -12,29 +20,242 @@ struct AeroCoeffs {
     float Cl;       // lift coefficient
     float Cd;       // drag coefficient
     float Cm;       // moment coefficient (about pitch axis)
-    float Cl_roll;  // unused placeholder
-    float Cn_yaw;   // unused placeholder
+    float Cl_roll;  // rolling moment coefficient (stability model, 0 otherwise)
+    float Cn_yaw;   // yawing moment coefficient (stability model, 0 otherwise)
 };
 
 // ---------------------------
-// Airfoil: holds (alpha, Cl, Cd, Cm)
+// Polar segment: one interval of the table, node values plus per-degree
+// slopes toward the next node, so a sample is one FMA per coefficient.
+// ---------------------------
+struct alignas(32) PolarSegment {
+    float alpha;            // node alpha (deg)
+    float Cl, Cd, Cm;       // node values
+    float dCl, dCd, dCm;    // slopes (per deg) to the next node
+    float width;            // interval width (deg)
+};
+
+// ---------------------------
+// AirfoilProperties: derived once per polar (when its PolarData is built or
+// baked) and read by the paper aero model instead of hard-coded guesses.
+// ---------------------------
+struct AirfoilProperties {
+    float clAlpha;      // dCl/dalpha (per rad) around 0 deg
+    float zeroLiftDeg;  // Cl = 0 upward crossing nearest 0 deg
+    float stallDeg;     // alpha of CLmax
+    float clMax;
+    float cd0;          // minimum Cd
+
+    bool operator==(const AirfoilProperties&) const = default;
+};
+
+// values the paper model used before it took airfoil data: 2*pi slope,
+// symmetric section, 15 deg stall
+constexpr AirfoilProperties paperDefaultProperties(float Cd0)
+{
+    return { 2.0f * 3.14159265358979323846f, 0.0f, 15.0f, 0.0f, Cd0 };
+}
+
+// Property extraction over a segment table; constexpr so built-in polars
+// bake it, and the same code runs when a PolarData is built at runtime.
+constexpr AirfoilProperties computeAirfoilProperties(const PolarSegment* segs, size_t count)
+{
+    constexpr float DEG2RAD_C = 3.14159265358979323846f / 180.0f;
+    auto absf = [](float x) { return x < 0.0f ? -x : x; };
+
+    AirfoilProperties p = paperDefaultProperties(0.02f);
+    if (count == 0) return p;
+
+    // Cl-alpha: +/- 2 segments around the one bracketing 0 deg
+    if (count + 1 >= 3) {
+        size_t idx = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (segs[i].alpha <= 0.0f && segs[i].alpha + segs[i].width >= 0.0f) { idx = i; break; }
+        }
+        float sumNum = 0.0f, sumDen = 0.0f;
+        int nSamples = 0;
+        for (int k = -2; k <= 2; ++k) {
+            long i = long(idx) + k;
+            if (i >= 0 && i < long(count)) {
+                const PolarSegment& s = segs[i];
+                float da = s.width * DEG2RAD_C;
+                if (absf(da) > 1e-6f) {
+                    sumNum += s.dCl * s.width;
+                    sumDen += da;
+                    ++nSamples;
+                }
+            }
+        }
+        if (nSamples > 0 && absf(sumDen) >= 1e-9f) p.clAlpha = sumNum / sumDen;
+    }
+
+    // stall / CLmax / Cd0 over every node (last node from the last segment)
+    p.stallDeg = segs[0].alpha;
+    p.clMax = segs[0].Cl;
+    p.cd0 = segs[0].Cd;
+    for (size_t i = 0; i <= count; ++i) {
+        const PolarSegment& s = segs[i < count ? i : count - 1];
+        const float w = (i < count) ? 0.0f : s.width;
+        const float a = s.alpha + w, cl = s.Cl + s.dCl * w, cd = s.Cd + s.dCd * w;
+        if (cl > p.clMax) { p.clMax = cl; p.stallDeg = a; }
+        if (cd < p.cd0) p.cd0 = cd;
+    }
+
+    // zero-lift angle: upward Cl crossing nearest 0 deg
+    bool found = false;
+    for (size_t i = 0; i < count; ++i) {
+        const PolarSegment& s = segs[i];
+        if (s.Cl <= 0.0f && s.Cl + s.dCl * s.width > 0.0f && s.dCl != 0.0f) {
+            float a0 = s.alpha - s.Cl / s.dCl;
+            if (!found || absf(a0) < absf(p.zeroLiftDeg)) { p.zeroLiftDeg = a0; found = true; }
+        }
+    }
+    return p;
+}
+
+// ---------------------------
+// Cubic polar segment (monotone cubic / PCHIP mode): Horner coefficients in
+// d = alpha - node alpha (deg), packed as c[k] = (Cl_k, Cd_k, Cm_k, -) so one
+// sample is three vec4 multiply-adds. c[0].w holds the node alpha.
+// ---------------------------
+struct alignas(64) PolarCubicSegment {
+    glm::vec4 c[4];
+};
+
+enum class PolarInterpolation {
+    Linear,         // piecewise linear (kinks at nodes)
+    MonotoneCubic   // Fritsch-Carlson PCHIP: C1, no overshoot between nodes
+};
+
+// ---------------------------
+// PolarData: immutable lookup tables for one polar, shared between every
+// Airfoil handle that uses it. Segments and bracket live in one 64-byte
+// aligned block kept alive by `storage`.
+// ---------------------------
+struct alignas(64) PolarData {
+    const PolarSegment* segments = nullptr; // segmentCount intervals (1 for a single row)
+    const uint32_t* bracket = nullptr;      // non-uniform only: bucket -> first candidate segment
+    const PolarCubicSegment* cubic = nullptr; // MonotoneCubic only: one per segment
+    uint32_t segmentCount = 0;
+    uint32_t bracketCount = 0;
+    float min_alpha = 0.0f;
+    float max_alpha = 0.0f;
+    float inv_step = 0.0f;                  // 1 / grid step (uniform) or 1 / bucket width
+    bool uniform = true;
+    uint64_t hash = 0;                      // content hash of the segment (and cubic) tables
+    AirfoilProperties properties = paperDefaultProperties(0.02f); // derived once at build
+    std::shared_ptr<const void> storage;    // owner of the memory behind the pointers
+
+    // index of the segment containing alpha_deg (already clamped)
+    size_t segmentIndex(float alpha_deg) const;
+};
+
+// Build a standalone (not yet interned) polar from (alpha_deg, Cl, Cd, Cm) rows.
+std::shared_ptr<const PolarData> buildPolar(const std::vector<glm::vec4>& curve,
+                                            PolarInterpolation mode = PolarInterpolation::Linear);
+
+// ---------------------------
+// Polar Registry
+// ---------------------------
+// Shared polar for (alpha_deg, Cl, Cd, Cm) rows; identical tables (content
+// hash + compare) resolve to one instance while any handle holds it.
+std::shared_ptr<const PolarData> acquirePolar(const std::vector<glm::vec4>& curve,
+                                              PolarInterpolation mode = PolarInterpolation::Linear);
+
+// Canonical instance for an already-built polar (dedupes against live ones).
+std::shared_ptr<const PolarData> internPolar(std::shared_ptr<const PolarData> polar);
+
+// Number of distinct polars currently alive in the registry.
+size_t livePolarCount();
+
+// ---------------------------
+// Airfoil: shared handle to an immutable (alpha, Cl, Cd, Cm) polar
 // ---------------------------
 class Airfoil {
 public:
-    Airfoil(const std::vector<glm::vec4>& curve);
+    Airfoil(const std::vector<glm::vec4>& curve, PolarInterpolation mode = PolarInterpolation::Linear);
+    explicit Airfoil(std::shared_ptr<const PolarData> polar);
+
+    // optional alpha x Reynolds x Mach table; polar stays the alpha-only fallback.
+    // updatePhysics does not consult the grid yet (the lumped wing flies the
+    // paper model built from polar's properties); callers sample it
+    // themselves and keep their own PolarCellHint.
+    Airfoil(std::shared_ptr<const PolarData> polar, std::shared_ptr<const PolarGrid> grid);
 
     // const-correct: can be called on const Airfoil&
     AeroCoeffs sample(float alpha_deg) const;
 
-    // small helper to expose approximate 2D lift slope if needed
-    float estimateClAlpha2D() const;
+    // multilinear lookup in the grid (alpha-only sample when there is none);
+    // hint carries the previous cell between calls
+    AeroCoeffs sample(float alpha_deg, float reynolds, float mach, PolarCellHint* hint = nullptr) const;
+
+    // Batched sampling: AVX2 gathers when the CPU has them, SSE otherwise
+    // (monotone-cubic polars take the scalar path).
+    // AoS form fills AeroCoeffs (Cl_roll/Cn_yaw zeroed); SoA form writes
+    // contiguous Cl[], Cd[], Cm[] for downstream force kernels.
+    void sampleBatch(const float* alpha_deg, AeroCoeffs* out, size_t n) const;
+    void sampleBatch(const float* alpha_deg, float* Cl, float* Cd, float* Cm, size_t n) const;
+
+    // small helper to expose approximate 2D lift slope if needed (cached, per rad)
+    float estimateClAlpha2D() const { return polar->properties.clAlpha; }
+
+    // slope, zero-lift angle, stall, CLmax, Cd0 - computed once per polar
+    const AirfoilProperties& properties() const { return polar->properties; }
+
+    // true when the table is on a uniform alpha grid (direct index arithmetic)
+    bool isUniform() const { return polar->uniform; }
+
+    PolarInterpolation interpolation() const
+    {
+        return polar->cubic ? PolarInterpolation::MonotoneCubic : PolarInterpolation::Linear;
+    }
+
+    const PolarData& polarData() const { return *polar; }
+    const std::shared_ptr<const PolarData>& handle() const { return polar; }
+    const PolarGrid* polarGrid() const { return grid.get(); }
 
 private:
-    std::vector<glm::vec4> data; // (alpha_deg, Cl, Cd, Cm)
-    float min_alpha;
-    float max_alpha;
+    // shared batch driver: writes with a float stride so AoS and SoA share kernels
+    void sampleBatchStrided(const float* alpha_deg, float* Cl, float* Cd, float* Cm,
+                            size_t stride, size_t n) const;
+
+    std::shared_ptr<const PolarData> polar;
+    std::shared_ptr<const PolarGrid> grid;
 };
 
+// ---------------------------
+// Aero coefficient table: computeAeroCoeffsPaper tabulated once on the
+// quarter-degree AoA grid updatePhysics samples, for one (AR, airfoil
+// properties) pair.
+// ---------------------------
+struct AeroCoeffTable {
+    static constexpr float STEP_DEG = 0.25f;
+    static constexpr float MIN_DEG  = -180.0f;
+    static constexpr int   SIZE     = 1441;   // -180 .. +180 deg inclusive
+
+    float AR;
+    AirfoilProperties props;
+    std::vector<AeroCoeffs> entries;
+
+    AeroCoeffTable(float AR, const AirfoilProperties& props);
+
+    bool matches(float AR_, const AirfoilProperties& props_) const { return AR == AR_ && props == props_; }
+
+    // aoa_deg is expected on the quarter-degree grid (see roundToQuarter)
+    const AeroCoeffs& lookup(float aoa_deg) const;
+
+    // linear between neighbouring entries, for integrators that need loads
+    // continuous in the state
+    AeroCoeffs lookupLinear(float aoa_deg) const;
+};
+
+// Shared table for (AR, props); aircraft with the same wing and airfoil reuse one instance.
+std::shared_ptr<const AeroCoeffTable> acquireAeroCoeffTable(float AR, const AirfoilProperties& props);
+
+// Number of tables currently alive in that cache (expired slots are dropped
+// whenever a new table is built).
+size_t liveAeroCoeffTableCount();
+
 // ---------------------------
 // Aircraft (now with quaternion orientation)
 // ---------------------------
@@ -43,14 +264,39 @@ struct Aircraft {
 
     Airfoil airfoil;
 
+    // tabulated aero coefficients for the current wing; rebuilt lazily by
+    // updatePhysics when wingspan/wingArea no longer match its AR
+    std::shared_ptr<const AeroCoeffTable> aeroTable;
+
+    // optional 6-DOF stability/control derivatives (alpha x beta); null = pitch-only model
+    std::shared_ptr<const StabilityTable> stability;
+    PolarCellHint stabilityHint;
+
+    // optional spanwise strip model (see defaultStripWing); when set it replaces
+    // the lumped wing and the stability table for aero forces and moments
+    std::shared_ptr<const StripWing> strips;
+
+    // optional vortex-lattice model (see acquireVortexLattice); takes precedence
+    // over strips and, like them, yields body-axis loads
+    std::shared_ptr<const VortexLattice> lattice;
+
     glm::vec3 position;          // world
     glm::vec3 velocity;          // world
     glm::vec3 acceleration;      // world
 
     glm::quat orientation;       // body <- world rotation (body to world: orientation * v_body)
-    glm::vec3 angularVelocity;   // body rates (p,q,r) in body frame
+    glm::vec3 angularVelocity;   // body rates (roll x, yaw y, pitch z) in body frame
     glm::vec3 angularAcceleration; // body frame
 
+    // how updatePhysics advances orientation from the body rates (see
+    // integrators.h). ExpMap/Magnus pay off where the rates are prescribed
+    // (phi::RigidBody, orientation_bench case 1). Here the rates come from
+    // the loads, so the rate update bounds the error: under the default
+    // semi-implicit Euler they come out worse than Linear (up to 1.6x at 8x
+    // the 120 Hz step), under RK4 (RKMK) within 1% of it. For fast rolls
+    // here, a higher-order policy (RK4) is what helps.
+    OrientationUpdate orientationUpdate;
+
     float mass;
 
     // wing geometry (reference)
@@ -61,6 +307,9 @@ struct Aircraft {
     // thrust (along body X axis)
     float thrust;
 
+    // control deflections (aileron, elevator, rudder), rad; used by the stability model
+    glm::vec3 controls;
+
     // inertia: principal moments (Ixx, Iyy, Izz) in body frame
     glm::vec3 inertia;           // diagonal inertia principal moments
     glm::vec3 inertiaInv;        // precomputed inverse diagonal
@@ -79,7 +328,12 @@ struct Aircraft {
 // Utility
 // ---------------------------
 float roundToQuarter(float x);
-float estimateCm(float alpha_deg); // estimate Cm (deg input) fallback
+// estimate Cm (deg input) fallback; constexpr so built-in polars bake it in
+constexpr float estimateCm(float alpha_deg) {
+    if (alpha_deg < 0.0f) return -0.05f;
+    if (alpha_deg > 15.0f) return -0.09f;
+    return -0.05f - 0.04f * (alpha_deg / 15.0f);
+}
 
 // ---------------------------
 // Aerodynamic Helper Functions
@@ -93,18 +347,140 @@ float inducedAngleFromCL(float CL, float AR);
 // Compute aerodynamic coefficients using paper method (whole-surface simplified).
 // alpha_deg: geometric AoA in degrees (positive nose-up).
 // AR: aspect ratio (b^2 / S).
-// Cd0: skin friction baseline used for low-AoA CT estimation.
+// props: airfoil slope, zero-lift angle, stall angle and Cd0 (see Airfoil::properties()).
+AeroCoeffs computeAeroCoeffsPaper(float alpha_deg, float AR, const AirfoilProperties& props);
+
+// Legacy form: paperDefaultProperties(Cd0) (2*pi slope, no camber, 15 deg stall).
 AeroCoeffs computeAeroCoeffsPaper(float alpha_deg, float AR, float Cd0);
 
+// The same model on any scalar - float, or Dual<N> for dCl/dalpha etc.
+// computeAeroCoeffsPaper is the float instantiation.
+template <class S>
+struct PaperCoeffs {
+    S Cl, Cd, Cm;
+};
+
+template <class S>
+PaperCoeffs<S> paperCoeffs(S alpha_deg, float AR, const AirfoilProperties& props);
+
 // ---------------------------
 // Physics Update
 // ---------------------------
+RigidState aircraftState(const Aircraft& plane);
+void setAircraftState(Aircraft& plane, const RigidState& s);
+
+// Loads and rigid-body derivative at state s (controls, thrust and the aero
+// model from plane). record writes the diagnostics (lift, drag, thrustVec,
+// totalForce, accelerations) back to plane; quantizeAoA samples the lumped
+// table at the quarter degree instead of interpolating.
+RigidDerivative aircraftDerivative(Aircraft& plane, const RigidState& s, bool record = true, bool quantizeAoA = true);
+
+// ---------------------------
+// Exact derivatives: the force and moment model templated on its scalar.
+// aircraftDerivative<S> runs the lumped and stability-table models on a
+// Dual<N> (with thrust and controls as inputs, so they can carry partials
+// too); AoA is always interpolated, as with quantizeAoA = false. The strip
+// and lattice kernels are float-only, and return NaN here.
+//
+// Instantiated in physicsengine.cpp for float, Dual<6> (trim) and
+// AircraftDual.
+// ---------------------------
+static constexpr int AIRCRAFT_STATE_SIZE = 13;  // position, velocity, orientation (w x y z), body rates
+static constexpr int AIRCRAFT_INPUT_SIZE = 4;   // thrust, aileron, elevator, rudder
+using AircraftDual = Dual<AIRCRAFT_STATE_SIZE + AIRCRAFT_INPUT_SIZE>;
+
+template <class S>
+RigidDerivativeOf<S> aircraftDerivative(Aircraft& plane, const RigidStateOf<S>& s, const S& thrust,
+                                        const glm::vec<3, S>& controls);
+
+// true when aircraftDerivative<Dual<N>> covers plane's model
+inline bool dualDerivatives(const Aircraft& plane) { return !plane.strips && !plane.lattice; }
+
+// Derivative and its partials, both packed in the state order above; the
+// quaternion's four components count as independent coordinates.
+struct AircraftJacobian {
+    RigidDerivative f;
+    float A[AIRCRAFT_STATE_SIZE][AIRCRAFT_STATE_SIZE];  // d f / d state
+    float B[AIRCRAFT_STATE_SIZE][AIRCRAFT_INPUT_SIZE];  // d f / d (thrust, controls)
+};
+
+// One AircraftDual pass at s with plane's thrust and controls. false (with a
+// message on stderr) when !dualDerivatives(plane).
+bool aircraftJacobian(Aircraft& plane, const RigidState& s, AircraftJacobian& out);
+
+// Derivative of each aircraft at its current state, without diagnostics;
+// aircraft sharing a VortexLattice are solved as one batch.
+void aircraftDerivatives(Aircraft* planes, size_t count, RigidDerivative* out, bool quantizeAoA = true);
+
+// One step with a policy from integrators.h; diagnostics reflect the loads
+// at the start of the step. Stateful policies (RK45) are passed in so their
+// step size carries over between calls.
+template <class Integrator>
+void updatePhysics(Aircraft& plane, float dt, Integrator& integrator)
+{
+    if (dt <= 0.0f) return;
+    RigidState s = aircraftState(plane);
+    bool first = true;
+    integrator.step([&](const RigidState& x) {
+        RigidDerivative d = aircraftDerivative(plane, x, first, Integrator::quantizeAoA);
+        first = false;
+        return d;
+    }, s, dt);
+    setAircraftState(plane, s);
+}
+
+// Fresh policy per call; policies with a rotation setting take the
+// aircraft's orientationUpdate.
+template <class Integrator>
+void updatePhysics(Aircraft& plane, float dt)
+{
+    Integrator integrator;
+    if constexpr (requires { integrator.rotation; }) integrator.rotation = plane.orientationUpdate;
+    updatePhysics(plane, dt, integrator);
+}
+
+// Semi-implicit Euler, as updatePhysics<SemiImplicitEuler>(plane, dt).
 void updatePhysics(Aircraft& plane, float aoa_unused, float sideslip_unused, float dt);
 
+// ---------------------------
+// Compile-time physics variants: updatePhysics<Features>(plane, dt) is the
+// semi-implicit Euler step with the switched-off work compiled out. The
+// inertia is diagonal in every variant (Aircraft stores principal moments
+// only), so there is no flag for it.
+// ---------------------------
+struct PhysicsFeatures {
+    bool rotation = true;       // false: point mass (3-DOF) - no moments, orientation and rates held
+    bool gyroscopic = true;     // omega x (I omega) in Euler's equations
+    bool liftFallback = true;   // guard the lift direction when the velocity lies along the span
+    bool diagnostics = true;    // write lift, drag, thrustVec, totalForce, accelerations, bodyMoment
+};
+
+inline constexpr PhysicsFeatures FULL_PHYSICS{};                             // = updatePhysics(plane, 0, 0, dt)
+inline constexpr PhysicsFeatures NO_DIAGNOSTICS_PHYSICS{true, true, true, false};
+inline constexpr PhysicsFeatures NO_GYRO_PHYSICS{true, false, true, false};
+inline constexpr PhysicsFeatures POINT_MASS_PHYSICS{false, false, true, false}; // background traffic
+
+// Instantiated in physicsengine.cpp for the presets above.
+template <PhysicsFeatures F>
+void updatePhysics(Aircraft& plane, float dt);
+
+// Steps count aircraft; those sharing a VortexLattice are solved as one batch.
+void updatePhysics(Aircraft* planes, size_t count, float dt);
+
+// Same, spread over the pool in chunks of `chunk` aircraft (lattice batching
+// happens within a chunk). Aircraft are independent, so the result is the
+// same as the serial call for any thread count.
+class ThreadPool;
+void updatePhysics(ThreadPool& pool, Aircraft* planes, size_t count, float dt, size_t chunk = 64);
+
 // ---------------------------
 // Factory
 // ---------------------------
 // orientationEuler in degrees: (pitch, yaw, roll) or (x,y,z) — interpreted as (pitch, yaw, roll).
+// sharedAeroTable = false leaves aeroTable empty, for a caller that attaches
+// a private table to a one-off wing (Monte-Carlo geometry draws) instead of
+// filling the shared cache; updatePhysics acquires the shared one if it is
+// still empty.
 Aircraft createAirplane(const Airfoil& foil,
                         glm::vec3 position,
                         glm::vec3 orientationEulerDeg,
@@ -113,6 +489,10 @@ Aircraft createAirplane(const Airfoil& foil,
                         float wingspan,
                         float chord,
                         float thrust,
-                        glm::vec3 inertiaPrincipal);
+                        glm::vec3 inertiaPrincipal,
+                        bool sharedAeroTable = true);
+
+// wingspan^2 / wingArea (1 for a degenerate wing): the AR aero tables are keyed on
+float aspectRatio(const Aircraft& plane);
 
 #endif // PHYSICSENGINE_H
@@ -0,0 +1,110 @@
+#ifndef POLARDB_H
+#define POLARDB_H
+#include "physicsengine.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ---------------------------
+// Binary polar database (.pdb), little-endian, opened zero-copy via mmap.
+//
+//   [PolarDbHeader]                      64 bytes
+//   [PolarDbEntry x airfoilCount]        directory, 128 bytes per airfoil
+//   per airfoil, each block 64-byte aligned:
+//     alpha[rows] Cl[rows] Cd[rows] Cm[rows]   float columns, columnStride apart
+//     PolarSegment[segmentCount]               lookup table used by Airfoil
+//     uint32_t bracket[bracketCount]           non-uniform bucket index
+//
+// The segment/bracket blocks are exactly what PolarData points at, so an
+// Airfoil opened from the database reads the mapping directly.
+// ---------------------------
+static constexpr char     POLARDB_MAGIC[8] = {'P', 'L', 'R', 'D', 'B', 0, 0, 0};
+static constexpr uint32_t POLARDB_VERSION  = 1;
+static constexpr uint32_t POLARDB_ALIGN    = 64;
+
+enum PolarDbFlags : uint32_t {
+    POLARDB_UNIFORM = 1u << 0,
+};
+
+struct PolarDbHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t airfoilCount;
+    uint64_t directoryOffset;
+    uint64_t fileSize;
+    uint8_t  reserved[32];
+};
+
+struct PolarDbEntry {
+    char     name[64];          // NUL-terminated
+    uint32_t rowCount;
+    uint32_t segmentCount;
+    uint32_t bracketCount;
+    uint32_t flags;             // PolarDbFlags
+    float    min_alpha;
+    float    max_alpha;
+    float    inv_step;
+    uint32_t columnStride;      // bytes between consecutive float columns
+    uint64_t columnsOffset;     // alpha column; Cl/Cd/Cm follow at columnStride
+    uint64_t segmentsOffset;
+    uint64_t bracketOffset;     // 0 when bracketCount == 0
+    uint64_t hash;              // PolarData::hash of the segment table
+};
+
+static_assert(sizeof(PolarDbHeader) == 64, "PolarDbHeader layout");
+static_assert(sizeof(PolarDbEntry) == 128, "PolarDbEntry layout");
+
+// ---------------------------
+// Writer
+// ---------------------------
+struct PolarDbSource {
+    std::string name;
+    std::vector<glm::vec4> curve;   // (alpha_deg, Cl, Cd, Cm)
+};
+
+// Returns false (and reports to stderr) on I/O failure or an airfoil
+// without rows.
+bool writePolarDatabase(const std::string& path, const std::vector<PolarDbSource>& airfoils);
+
+// ---------------------------
+// Reader: read-only mapping, directory and lookup blocks validated on
+// open; polars are materialized lazily as views into the mapping.
+// ---------------------------
+class PolarDatabase : public std::enable_shared_from_this<PolarDatabase> {
+public:
+    // nullptr (with a message on stderr) if the file is missing or malformed
+    static std::shared_ptr<const PolarDatabase> open(const std::string& path);
+
+    ~PolarDatabase();
+    PolarDatabase(const PolarDatabase&) = delete;
+    PolarDatabase& operator=(const PolarDatabase&) = delete;
+
+    size_t size() const { return count; }
+    const PolarDbEntry& entry(size_t i) const { return directory[i]; }
+    const char* name(size_t i) const { return directory[i].name; }
+
+    // index of the named airfoil, or -1
+    long find(const std::string& name) const;
+
+    // raw float columns of airfoil i (0 = alpha, 1 = Cl, 2 = Cd, 3 = Cm)
+    const float* column(size_t i, int col) const;
+
+    // zero-copy polar / airfoil backed by the mapping (keeps it alive)
+    std::shared_ptr<const PolarData> polar(size_t i) const;
+    Airfoil airfoil(size_t i) const { return Airfoil(polar(i)); }
+
+private:
+    PolarDatabase() = default;
+
+    const unsigned char* base = nullptr;
+    size_t length = 0;
+    const PolarDbEntry* directory = nullptr;
+    size_t count = 0;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+#endif // POLARDB_H
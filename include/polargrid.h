@@ -0,0 +1,77 @@
+#ifndef POLARGRID_H
+#define POLARGRID_H
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct AeroCoeffs;
+
+// ---------------------------
+// Last-cell hint: per-caller (e.g. per-aircraft) memory of the cell used by
+// the previous lookup. Consecutive steps usually land in the same or an
+// adjacent cell, so the axis search is skipped. -1 means "no hint".
+// ---------------------------
+struct PolarCellHint {
+    int32_t alpha = -1;
+    int32_t re = -1;
+    int32_t mach = -1;
+};
+
+// ---------------------------
+// Polar axis: monotone breakpoints for one table dimension
+// ---------------------------
+struct PolarAxis {
+    std::vector<float> nodes;
+    float min_value = 0.0f;
+    float max_value = 0.0f;
+    float inv_step = 0.0f;   // uniform axes only
+    bool uniform = true;
+
+    explicit PolarAxis(std::vector<float> breakpoints);
+
+    int cells() const { return nodes.size() > 1 ? int(nodes.size()) - 1 : 1; }
+
+    // cell containing x (clamped) and the local coordinate t in [0,1];
+    // hint is checked (and its neighbours) before falling back to a search
+    int locate(float x, int32_t& hint, float& t) const;
+};
+
+// ---------------------------
+// PolarGrid: Cl/Cd/Cm over alpha x Reynolds x Mach with multilinear
+// interpolation. Axes with a single breakpoint collapse, so the same table
+// serves 1D, 2D and 3D data.
+//
+// Storage is cell-major, alpha fastest: each cell holds its precomputed
+// multilinear coefficients (1, u, v, uv, w, uw, vw, uvw) x (Cl, Cd, Cm, 0),
+// i.e. 32/64/128 bytes for 1D/2D/3D. A lookup therefore touches one cell
+// (at most two cache lines), and a query near the previous one stays in
+// the same or the neighbouring cell in memory.
+// ---------------------------
+class PolarGrid {
+public:
+    // values are (Cl, Cd, Cm) indexed [mach][re][alpha], alpha fastest.
+    // Returns nullptr (with a message on stderr) on inconsistent input.
+    static std::shared_ptr<const PolarGrid> create(std::vector<float> alpha_deg,
+                                                   std::vector<float> reynolds,
+                                                   std::vector<float> mach,
+                                                   const std::vector<glm::vec3>& values);
+
+    AeroCoeffs sample(float alpha_deg, float reynolds, float mach, PolarCellHint* hint = nullptr) const;
+
+    int dimensions() const { return dims; }
+    const PolarAxis& alphaAxis() const { return axes[0]; }
+    const PolarAxis& reynoldsAxis() const { return axes[1]; }
+    const PolarAxis& machAxis() const { return axes[2]; }
+
+private:
+    PolarGrid(PolarAxis a, PolarAxis r, PolarAxis m);
+
+    PolarAxis axes[3];
+    int dims = 0;                   // number of axes with more than one breakpoint
+    int active[3] = {0, 0, 0};      // active axis ids, in term-bit order
+    int terms = 1;                  // 2^dims coefficient vectors per cell
+    std::shared_ptr<glm::vec4> cells; // 64-byte aligned, terms * cellCount vec4s
+};
+
+#endif // POLARGRID_H
@@ -0,0 +1,81 @@
+#ifndef SIMTHREAD_H
+#define SIMTHREAD_H
+#include "physicsengine.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// ---------------------------
+// Published aircraft state: what the render thread needs from one step
+// ---------------------------
+struct SimState {
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::quat orientation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 velocity = glm::vec3(0.0f);
+    glm::vec3 lift = glm::vec3(0.0f);
+    glm::vec3 drag = glm::vec3(0.0f);
+    glm::vec3 thrustVec = glm::vec3(0.0f);
+    uint64_t step = 0;          // steps taken to reach this state
+};
+
+SimState captureState(const Aircraft& plane, uint64_t step);
+
+// Pose between two states: position lerped, orientation slerped (shortest
+// arc); the force vectors and step are taken from b.
+SimState interpolateState(const SimState& a, const SimState& b, float alpha);
+
+// ---------------------------
+// SimThread: steps one aircraft at a fixed dt on its own thread, on a
+// wall-clock schedule (step k is due at start + k*dt) independent of the
+// frame rate. Steps that fall behind are run back to back; a backlog of
+// more than maxCatchUp steps (debugger break, sleep) is dropped rather than
+// replayed, so the sim never spirals. Results depend only on the number
+// of steps taken, never on frame timing.
+//
+// The render thread calls latest() once per frame and draws the pose
+// interpolated between the two newest states, one step behind real time.
+// ---------------------------
+class SimThread {
+public:
+    // called on the sim thread before every step (controls, thrust, ...);
+    // return false to end the run
+    using StepHook = std::function<bool(Aircraft&)>;
+
+    SimThread(const Aircraft& plane, float dt, StepHook hook = StepHook(), int maxCatchUp = 8);
+    ~SimThread();
+
+    SimThread(const SimThread&) = delete;
+    SimThread& operator=(const SimThread&) = delete;
+
+    void stop();
+    bool running() const { return !finished.load(std::memory_order_acquire); }
+    float stepSize() const { return dt; }
+
+    // two newest states and where real time sits between them, in [0, 1]
+    float latest(SimState& prev, SimState& curr) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void run();
+    void publish(Clock::time_point due);
+
+    Aircraft plane;             // owned by the sim thread once started
+    const float dt;
+    const int maxCatchUp;
+    StepHook hook;
+    uint64_t steps = 0;
+
+    mutable std::mutex stateMutex;
+    SimState prevState, currState;
+    Clock::time_point currDue;  // wall-clock time currState stands for
+
+    std::atomic<bool> stopRequested{false};
+    std::atomic<bool> finished{false};
+    std::thread thread;
+};
+
+#endif // SIMTHREAD_H
@@ -0,0 +1,69 @@
+#ifndef STABILITY_H
+#define STABILITY_H
+#include "polargrid.h"
+#include <memory>
+#include <vector>
+
+// ---------------------------
+// Stability / control derivatives for one (alpha, beta) point, fused into a
+// single 64-byte record so one lookup yields the whole 6-DOF set.
+// Rate derivatives are per radian of the non-dimensional rates
+// p*b/2V, q*c/2V, r*b/2V; control derivatives are per radian of deflection.
+// Signs follow the usual aero axes (x forward, y right, z down: positive Cn
+// yaws the nose right); updatePhysics maps them onto the body frame (x
+// forward, y up, z span), where pitch is about z and yaw about -y.
+// ---------------------------
+struct alignas(64) StabilityCoeffs {
+    float CY;       // side force (sideslip)
+    float Cl;       // rolling moment (dihedral effect)
+    float Cn;       // yawing moment (weathercock)
+    float Cl_p;     // roll damping
+    float Cm_q;     // pitch damping
+    float Cn_r;     // yaw damping
+    float Cl_r;     // roll due to yaw rate
+    float Cn_p;     // yaw due to roll rate
+    float CY_dr;    // side force per rudder
+    float Cl_da;    // roll per aileron
+    float Cn_da;    // adverse yaw per aileron
+    float Cl_dr;    // roll per rudder
+    float Cn_dr;    // yaw per rudder
+    float Cm_de;    // pitch per elevator
+    float CL_de;    // lift per elevator
+    float pad;
+};
+
+static_assert(sizeof(StabilityCoeffs) == 16 * sizeof(float), "StabilityCoeffs is one cache line");
+
+// ---------------------------
+// StabilityTable: StabilityCoeffs over alpha x beta (deg), bilinear.
+// Records are stored beta-major, alpha fastest, so the two alpha-adjacent
+// corners of a cell are neighbouring cache lines.
+// ---------------------------
+class StabilityTable {
+public:
+    // records indexed [beta][alpha], alpha fastest.
+    // Returns nullptr (with a message on stderr) on inconsistent input.
+    static std::shared_ptr<const StabilityTable> create(std::vector<float> alpha_deg,
+                                                        std::vector<float> beta_deg,
+                                                        std::vector<StabilityCoeffs> records);
+
+    // hint.alpha / hint.re (used for beta) carry the previous cell
+    StabilityCoeffs sample(float alpha_deg, float beta_deg, PolarCellHint* hint = nullptr) const;
+
+    // also every field's slope per degree of alpha and of beta (zero along a
+    // collapsed axis or outside the table, where the input is clamped)
+    StabilityCoeffs sample(float alpha_deg, float beta_deg, StabilityCoeffs& dAlpha, StabilityCoeffs& dBeta,
+                           PolarCellHint* hint = nullptr) const;
+
+private:
+    StabilityTable(PolarAxis a, PolarAxis b) : alpha(std::move(a)), beta(std::move(b)) {}
+
+    PolarAxis alpha;
+    PolarAxis beta;
+    std::vector<StabilityCoeffs> records;
+};
+
+// Typical light-aircraft derivatives (CY/Cl/Cn linear in beta), shared instance
+std::shared_ptr<const StabilityTable> defaultStabilityTable();
+
+#endif // STABILITY_H
@@ -0,0 +1,76 @@
+#ifndef STRIPWING_H
+#define STRIPWING_H
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct AirfoilProperties;
+
+// ---------------------------
+// Strip-theory lifting surface description (body frame: x forward, y up,
+// z right). Each surface spans along z, symmetric about its root point.
+// ---------------------------
+struct StripSurface {
+    glm::vec3 root{0.0f};       // quarter-chord point on the centreline
+    float span = 1.0f;          // tip to tip
+    float rootChord = 0.1f;
+    float tipChord = 0.1f;
+    float incidenceDeg = 0.0f;
+    int strips = 32;            // spanwise strips across the whole span
+    float aileron = 0.0f;       // outboard fraction of each half carrying aileron (0 = none)
+    float elevator = 0.0f;      // incidence change per unit elevator (1 = all-moving tail)
+};
+
+// Body-frame aerodynamic force and moment about the CG
+struct StripLoads {
+    glm::vec3 force{0.0f};
+    glm::vec3 moment{0.0f};
+};
+
+// ---------------------------
+// StripWing: all strips of all surfaces in one SoA block (padded to 8
+// lanes), each strip carrying an offset into a private copy of its
+// surface's quarter-degree coefficient table. evaluate() computes the local
+// flow (body velocity + omega x r), incidence, table lookup and strip loads
+// for every strip in one SIMD pass and reduces force/moment in registers.
+//
+// Moments are the true body-axis vector r x F (x roll, y yaw, z pitch), so
+// roll/yaw damping and asymmetric stall follow from the local flow alone.
+// ---------------------------
+class StripWing {
+public:
+    // Returns nullptr (with a message on stderr) on invalid geometry.
+    static std::shared_ptr<const StripWing> create(const std::vector<StripSurface>& surfaces,
+                                                   const AirfoilProperties& props);
+
+    // velBody: CG velocity in body frame; omega: body rates; controls: (aileron, elevator, rudder) rad
+    StripLoads evaluate(const glm::vec3& velBody, const glm::vec3& omega, const glm::vec3& controls,
+                        float rho = 1.225f) const;
+
+    size_t size() const { return count; }
+
+private:
+    StripWing() = default;
+
+    size_t count = 0;       // real strips
+    size_t padded = 0;      // count rounded up to the SIMD width
+
+    // SoA, one entry per (padded) strip
+    std::vector<float> x, y, z;         // quarter-chord point relative to the CG
+    std::vector<float> area, chord;
+    std::vector<float> incidence;       // deg
+    std::vector<float> aileronMix;      // deg per rad of aileron
+    std::vector<float> elevatorMix;     // deg per rad of elevator
+    std::vector<int32_t> base;          // first table entry of the strip's surface
+
+    // (Cl, Cd, Cm, 0) per quarter-degree entry, one AeroCoeffTable per surface
+    std::vector<float> coeffs;
+};
+
+// Single rectangular wing matching the aircraft's reference geometry
+// (wingspan, wingArea / wingspan chord), ailerons on the outer 30%.
+struct Aircraft;
+std::shared_ptr<const StripWing> defaultStripWing(const Aircraft& plane, int strips = 32);
+
+#endif // STRIPWING_H
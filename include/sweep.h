@@ -0,0 +1,142 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+#include "physicsengine.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+// ---------------------------
+// Parameter sweeps / Monte-Carlo over createAirplane
+//
+// A SweepSpec crosses grid parameters (evenly spaced, every combination)
+// with `samples` random draws of the uniform / normal parameters; case i
+// is generated from (spec, i) alone - the draws come from a counter-based
+// hash of (seed, i, parameter), never from a shared generator - so cases
+// can be made lazily, in any order, on any thread, and still come out the
+// same. Each case flies createAirplane(...) from the case's values for
+// `duration` seconds and reduces the run to one SweepRecord.
+// ---------------------------
+enum SweepVar : uint32_t {
+    SWEEP_MASS, SWEEP_WING_AREA, SWEEP_WINGSPAN, SWEEP_CHORD, SWEEP_THRUST,
+    SWEEP_IXX, SWEEP_IYY, SWEEP_IZZ,
+    SWEEP_ALTITUDE,                         // initial position.y, m
+    SWEEP_SPEED,                            // initial velocity along world +x, m/s
+    SWEEP_PITCH, SWEEP_YAW, SWEEP_ROLL,     // initial attitude, deg (createAirplane order)
+    SWEEP_ROLL_RATE, SWEEP_PITCH_RATE, SWEEP_YAW_RATE,   // initial body rates (x, y, z), rad/s
+    SWEEP_VAR_COUNT
+};
+
+const char* sweepVarName(SweepVar v);
+
+enum class SweepDist : uint32_t { Grid, Uniform, Normal };
+
+struct SweepParam {
+    SweepVar var;
+    SweepDist dist;
+    float a, b;         // Grid/Uniform: [a, b]; Normal: mean a, std dev b
+    uint32_t count;     // Grid points (a..b inclusive); ignored otherwise
+
+    static SweepParam grid(SweepVar v, float lo, float hi, uint32_t n) { return {v, SweepDist::Grid, lo, hi, n}; }
+    static SweepParam uniform(SweepVar v, float lo, float hi) { return {v, SweepDist::Uniform, lo, hi, 1}; }
+    static SweepParam normal(SweepVar v, float mean, float sd) { return {v, SweepDist::Normal, mean, sd, 1}; }
+};
+
+using SweepCase = std::array<float, SWEEP_VAR_COUNT>;
+
+// the demo aircraft of main.cpp
+SweepCase defaultSweepCase();
+
+struct SweepSpec {
+    SweepCase base = defaultSweepCase();    // values of the variables not swept
+    std::vector<SweepParam> params;         // each variable at most once
+    uint64_t samples = 1;                   // random draws per grid point
+    uint64_t seed = 1;
+
+    float duration = 10.0f;                 // simulated seconds per case
+    float dt = 1.0f / 120.0f;
+    float floor = 0.0f;                     // case ends when position.y drops below
+    float rateLimit = 100.0f;               // |body rate| above this (rad/s) counts as diverged
+};
+
+// 0 (with a message on stderr) if the spec is invalid or the count overflows
+uint64_t sweepCaseCount(const SweepSpec& spec);
+
+SweepCase sweepCase(const SweepSpec& spec, uint64_t index);
+// sharedAeroTable as for createAirplane
+Aircraft sweepAircraft(const Airfoil& foil, const SweepCase& c, bool sharedAeroTable = true);
+
+// ---------------------------
+// Per-case summary
+// ---------------------------
+enum SweepOutcome : uint32_t {
+    SWEEP_COMPLETED,        // flew the full duration
+    SWEEP_HIT_FLOOR,
+    SWEEP_DIVERGED,         // non-finite state or body rate over rateLimit
+};
+
+struct SweepRecord {
+    uint64_t caseIndex;
+    float endTime;          // simulated seconds flown
+    float minAltitude;
+    float finalAltitude;
+    float finalSpeed;
+    float maxRate;          // max |body rate|, rad/s
+    uint32_t outcome;       // SweepOutcome
+};
+
+static_assert(sizeof(SweepRecord) == 32, "SweepRecord layout");
+
+SweepRecord runSweepCase(const Airfoil& foil, const SweepSpec& spec, uint64_t index);
+
+// ---------------------------
+// Results file (.swp), little-endian:
+//
+//   [SweepFileHeader]               512 bytes; the spec, so case parameters
+//                                   can be regenerated with sweepCase
+//   [SweepRecord x caseCount]       in case order
+//
+// runSweep fills blocks of `block` cases across the pool (every case
+// writes only its own slot) and appends each block before starting the
+// next, so memory stays bounded and the file is identical for any thread
+// count. Returns false (and reports to stderr) on a bad spec or I/O error.
+// ---------------------------
+static constexpr char     SWEEP_MAGIC[8] = {'P', 'S', 'W', 'E', 'E', 'P', 0, 0};
+static constexpr uint32_t SWEEP_VERSION  = 1;
+
+struct SweepFileParam {
+    uint32_t var;
+    uint32_t dist;
+    float a, b;
+    uint32_t count;
+    uint32_t reserved;
+};
+
+struct SweepFileHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t paramCount;
+    uint64_t caseCount;
+    uint64_t samples;
+    uint64_t seed;
+    float    duration;
+    float    dt;
+    float    floor;
+    float    rateLimit;
+    float    base[SWEEP_VAR_COUNT];
+    SweepFileParam params[SWEEP_VAR_COUNT];
+    uint8_t  reserved[8];
+};
+
+static_assert(sizeof(SweepFileParam) == 24, "SweepFileParam layout");
+static_assert(sizeof(SweepFileHeader) == 512, "SweepFileHeader layout");
+
+bool runSweep(ThreadPool& pool, const Airfoil& foil, const SweepSpec& spec, const std::string& path,
+              size_t block = 65536);
+
+// Whole file; a run cut short yields the records written so far.
+bool readSweepResults(const std::string& path, SweepSpec& spec, std::vector<SweepRecord>& records);
+
+#endif // SWEEP_H
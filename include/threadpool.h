@@ -0,0 +1,104 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ---------------------------
+// ThreadPool: work-stealing parallel-for for stepping many aircraft.
+//
+// parallelFor(n, chunk, body) cuts [0, n) into chunks of `chunk` items and
+// deals them out as contiguous runs, one per participant (the workers plus
+// the calling thread, which joins in rather than blocking). A participant
+// takes chunks from the front of its own run; when that is empty it steals
+// the back half of another's. Chunk boundaries depend only on n and chunk,
+// never on the thread count, so per-chunk work is identical however it is
+// scheduled - parallelReduce relies on that to combine its partial results
+// in chunk order and return the same bits on 1 or 64 threads.
+//
+// One job runs at a time; parallelFor is not reentrant and must not be
+// called from inside a body.
+// ---------------------------
+struct ThreadPoolOptions {
+    unsigned threads = 0;   // participants including the caller; 0 = hardware_concurrency
+    bool pin = false;       // pin participant i to logical CPU firstCpu + i
+    unsigned firstCpu = 0;
+};
+
+class ThreadPool {
+public:
+    explicit ThreadPool(const ThreadPoolOptions& options = ThreadPoolOptions());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // participants, including the calling thread
+    unsigned size() const { return unsigned(workers.size()) + 1; }
+
+    // body(begin, end, participant) for every chunk; participant < size()
+    template <class Body>
+    void parallelFor(size_t n, size_t chunk, Body&& body)
+    {
+        using B = std::remove_reference_t<Body>;
+        run(n, chunk, [](void* ctx, size_t begin, size_t end, unsigned who) {
+            (*static_cast<B*>(ctx))(begin, end, who);
+        }, const_cast<void*>(static_cast<const void*>(&body)));
+    }
+
+    // map(begin, end) -> T per chunk, folded left to right in chunk order
+    // with combine(T, T); the result does not depend on the thread count
+    template <class T, class Map, class Combine>
+    T parallelReduce(size_t n, size_t chunk, T init, Map&& map, Combine&& combine)
+    {
+        if (n == 0) return init;
+        if (chunk == 0) chunk = 1;
+        std::vector<T> partial((n + chunk - 1) / chunk, init);
+        parallelFor(n, chunk, [&](size_t begin, size_t end, unsigned) { partial[begin / chunk] = map(begin, end); });
+        T result = std::move(init);
+        for (T& p : partial) result = combine(std::move(result), std::move(p));
+        return result;
+    }
+
+private:
+    using ChunkFn = void (*)(void* ctx, size_t begin, size_t end, unsigned who);
+
+    // one participant's run of chunk indices, [lo, hi) packed as hi << 32 | lo
+    struct alignas(64) Run {
+        std::atomic<uint64_t> range{0};
+    };
+
+    struct Job {
+        ChunkFn fn;
+        void* ctx;
+        size_t n;
+        size_t chunk;
+        std::atomic<size_t> remaining;  // chunks not yet finished
+    };
+
+    void run(size_t n, size_t chunk, ChunkFn fn, void* ctx);
+    void participate(Job& job, unsigned who);
+    void workerMain(unsigned who);
+    void pinCurrentThread(unsigned who) const;
+
+    ThreadPoolOptions options;
+    std::vector<std::thread> workers;
+    std::unique_ptr<Run[]> runs;        // size() entries
+
+    std::mutex mutex;
+    std::condition_variable wake;       // workers: new job or shutdown
+    std::condition_variable idle;       // caller: every worker has left the job
+    Job* job = nullptr;
+    uint64_t generation = 0;
+    unsigned busy = 0;                  // workers inside the current job
+    bool stopping = false;
+};
+
+#endif // THREADPOOL_H
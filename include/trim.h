@@ -0,0 +1,94 @@
+#ifndef TRIM_H
+#define TRIM_H
+#include "physicsengine.h"
+#include <cstddef>
+
+class ThreadPool;
+
+// ---------------------------
+// Trim: thrust, attitude and controls for steady flight
+//
+// A TrimCondition is a steady flight path - airspeed, climb angle and a
+// constant heading rate (0 = straight and level or climbing, otherwise a
+// steady turn). The solver looks for the unknowns that make updatePhysics'
+// loads produce exactly that motion:
+//
+//   unknowns   alpha (the model's AoA), bank about the flight path, thrust,
+//              and each of (aileron, elevator, rudder) the model responds to
+//   residuals  body-axis acceleration minus the turn's centripetal one,
+//              and the angular acceleration about the axes those controls
+//              reach
+//
+// Which controls count is probed once per batch. The lumped model has none,
+// so only its forces are trimmed; the default strip wing has ailerons only.
+// Moments nothing can trim are reported in angularAcceleration. Sideslip is
+// held at TrimCondition::sideslipDeg (0: coordinated).
+//
+// Newton iterations with Marquardt damping; the Jacobian is by forward
+// differences, and the base point plus every perturbation of every
+// condition in a batch go through one aircraftDerivatives call per
+// iteration (lattice aircraft share a single batched solve). With
+// TrimOptions::exactJacobian the lumped and stability-table models take
+// it from one Dual<6> aircraftDerivative pass per condition instead - free
+// of step-size error, though no faster for models this cheap. AoA is
+// sampled without the quarter-degree rounding so the residual is
+// continuous; stepping a trimmed lumped aircraft with the default
+// integrator rounds it again (at most 0.125 deg).
+// ---------------------------
+struct TrimCondition {
+    float speed = 10.0f;        // airspeed along the flight path, m/s
+    float climbDeg = 0.0f;      // flight-path angle above the horizon, deg
+    float turnRate = 0.0f;      // heading rate about world +y, rad/s
+    float sideslipDeg = 0.0f;   // held, not solved for
+    float altitude = 30.0f;     // position.y of the trimmed state
+};
+
+struct TrimOptions {
+    int maxIterations = 40;
+    float tolerance = 1e-3f;    // residual norm (m/s^2, rad/s^2) counted as trimmed
+
+    // starting point (warm-start with a neighbouring solution's values)
+    float alphaDeg = 2.0f;
+    float bankDeg = 0.0f;
+    float thrust = -1.0f;       // < 0: a tenth of the weight
+    glm::vec3 controls = glm::vec3(0.0f);
+
+    float controlLimit = 0.5f;  // |deflection| bound, rad
+    float maxThrust = 1e6f;
+
+    bool exactJacobian = false; // dual-number Jacobian where dualDerivatives(plane)
+};
+
+struct TrimSolution {
+    bool converged = false;
+    int iterations = 0;
+    float residual = 0.0f;      // final residual norm
+    glm::bvec3 trimmedControls = glm::bvec3(false);  // (aileron, elevator, rudder) solved for
+
+    float alphaDeg = 0.0f;
+    float bankDeg = 0.0f;
+    float thrust = 0.0f;
+    glm::vec3 controls = glm::vec3(0.0f);
+
+    RigidState state;           // flight state at trim (heading along world +x)
+    glm::vec3 angularAcceleration = glm::vec3(0.0f);  // left over at trim (untrimmed axes)
+};
+
+// Trims count conditions for plane's model in lockstep (plane's own state,
+// thrust and controls are ignored).
+void trimAircraft(const Aircraft& plane, const TrimCondition* conditions, TrimSolution* out, size_t count,
+                  const TrimOptions& options = TrimOptions());
+
+TrimSolution trimAircraft(const Aircraft& plane, const TrimCondition& condition,
+                          const TrimOptions& options = TrimOptions());
+
+// Same, with the conditions split into chunks of `chunk` over the pool;
+// each chunk is a lockstep batch over the controls resolved from
+// conditions[0], as in the serial call, so results match it.
+void trimAircraft(ThreadPool& pool, const Aircraft& plane, const TrimCondition* conditions, TrimSolution* out,
+                  size_t count, const TrimOptions& options = TrimOptions(), size_t chunk = 16);
+
+// Puts the trimmed state, thrust and controls on plane.
+void applyTrim(Aircraft& plane, const TrimSolution& trim);
+
+#endif // TRIM_H
@@ -0,0 +1,78 @@
+#ifndef VORTEXLATTICE_H
+#define VORTEXLATTICE_H
+#include "stripwing.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct AirfoilProperties;
+
+// ---------------------------
+// VortexLattice: horseshoe-vortex lattice over StripSurface planforms
+// (strips spanwise x chordwise panels, body frame, trailing legs to -x).
+//
+// The aerodynamic influence matrix depends only on geometry, so it is
+// assembled and LU-factorized once (double precision, stored as float) when
+// the lattice is created. A step only builds the right-hand side (flow
+// normal to each panel from velocity, omega x r, incidence, controls and
+// the section's zero-lift angle), back-substitutes, and multiplies the
+// circulations by a second cached matrix for the downwash at the bound
+// vortices. Lift distribution and induced drag follow from Kutta-Joukowski
+// on each bound vortex; profile drag adds the polar's Cd0 per panel.
+//
+// evaluateBatch() stacks the right-hand sides of many aircraft of the same
+// type into one panel x aircraft block and runs the triangular solves and
+// the downwash product blocked over it.
+// ---------------------------
+class VortexLattice {
+public:
+    // chordwise: panels per strip. Returns nullptr (with a message on stderr)
+    // on invalid geometry or a singular influence matrix.
+    static std::shared_ptr<const VortexLattice> create(const std::vector<StripSurface>& surfaces, int chordwise,
+                                                       const AirfoilProperties& props);
+
+    // velBody: CG velocity in body frame; omega: body rates; controls: (aileron, elevator, rudder) rad.
+    // circulation, if given, receives panelCount() panel strengths (the lift distribution).
+    StripLoads evaluate(const glm::vec3& velBody, const glm::vec3& omega, const glm::vec3& controls,
+                        float rho = 1.225f, float* circulation = nullptr) const;
+
+    // count aircraft at once; out[i] matches evaluate() on the i-th inputs.
+    // circulation, if given, is panelCount() x count, panel-major.
+    void evaluateBatch(const glm::vec3* velBody, const glm::vec3* omega, const glm::vec3* controls,
+                       StripLoads* out, size_t count, float rho = 1.225f, float* circulation = nullptr) const;
+
+    size_t panelCount() const { return n; }
+
+private:
+    VortexLattice() = default;
+
+    size_t n = 0;
+
+    // per panel (SoA)
+    std::vector<float> cpx, cpy, cpz;           // control point (3/4 chord), relative to the CG
+    std::vector<float> mx, my, mz;              // bound vortex midpoint
+    std::vector<float> dlx, dlz;                // bound vortex vector (left to right)
+    std::vector<float> area;
+    std::vector<float> theta;                   // effective incidence (rad): incidence - zero-lift angle
+    std::vector<float> aileronMix, elevatorMix; // rad of incidence per rad of control
+    float cd0 = 0.0f;
+
+    // PA = LU, unit-lower L and U packed row-major; invDiag = 1 / U(i,i)
+    std::vector<float> lu;
+    std::vector<float> invDiag;
+    std::vector<uint32_t> perm;
+
+    // y-velocity at bound midpoint i from unit trailing legs of panel j, row-major
+    std::vector<float> downwash;
+};
+
+// Shared lattice for a geometry: aircraft of the same type reuse one factorization.
+std::shared_ptr<const VortexLattice> acquireVortexLattice(const std::vector<StripSurface>& surfaces, int chordwise,
+                                                          const AirfoilProperties& props);
+
+// Number of lattices currently alive in that cache (expired slots are dropped
+// whenever a new lattice is factored).
+size_t liveVortexLatticeCount();
+
+#endif // VORTEXLATTICE_H
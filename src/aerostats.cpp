@@ -0,0 +1,129 @@
+#include "aerostats.h"
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+#ifdef PHYSICS_AERO_STATS
+#include <mutex>
+#include <vector>
+#endif
+
+void AeroStats::add(const AeroStats& o)
+{
+    steps += o.steps;
+    linear += o.linear;
+    postStall += o.postStall;
+    liftDirFallback += o.liftDirFallback;
+    paperLinear += o.paperLinear;
+    paperPostStall += o.paperPostStall;
+    polarSamples += o.polarSamples;
+    for (int i = 0; i < AOA_BINS; ++i) aoa[i] += o.aoa[i];
+    for (int i = 0; i < TABLE_BINS; ++i) tableIndex[i] += o.tableIndex[i];
+    for (int i = 0; i < SEGMENT_BINS; ++i) segmentIndex[i] += o.segmentIndex[i];
+}
+
+#ifdef PHYSICS_AERO_STATS
+
+// ---------------------------
+// Per-thread blocks
+// ---------------------------
+namespace {
+std::mutex statsMutex;                  // registration, thread exit, collect/reset only
+std::vector<AeroStats*> liveBlocks;
+AeroStats retired;                      // totals of exited threads
+
+struct ThreadBlock {
+    AeroStats stats;
+
+    ThreadBlock()
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        liveBlocks.push_back(&stats);
+    }
+    ~ThreadBlock()
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        retired.add(stats);
+        liveBlocks.erase(std::find(liveBlocks.begin(), liveBlocks.end(), &stats));
+    }
+};
+} // namespace
+
+AeroStats& aeroStatsLocal()
+{
+    thread_local ThreadBlock block;
+    return block.stats;
+}
+
+AeroStats aeroStatsCollect()
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    AeroStats total = retired;
+    for (const AeroStats* s : liveBlocks) total.add(*s);
+    return total;
+}
+
+void aeroStatsReset()
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    retired = AeroStats();
+    for (AeroStats* s : liveBlocks) *s = AeroStats();
+}
+
+// ---------------------------
+// Dump
+// ---------------------------
+static double pct(uint64_t part, uint64_t whole) { return whole ? 100.0 * double(part) / double(whole) : 0.0; }
+
+void aeroStatsDump(std::ostream& os)
+{
+    const AeroStats s = aeroStatsCollect();
+    const std::ios::fmtflags flags = os.flags();
+    os << std::fixed << std::setprecision(2);
+
+    os << "aero stats: " << s.steps << " steps\n"
+       << "  linear     " << s.linear << " (" << pct(s.linear, s.steps) << "%)\n"
+       << "  post-stall " << s.postStall << " (" << pct(s.postStall, s.steps) << "%)\n"
+       << "  liftDir fallback " << s.liftDirFallback << "\n"
+       << "  computeAeroCoeffsPaper: linear " << s.paperLinear << ", post-stall " << s.paperPostStall << "\n";
+
+    os << "  AoA histogram (5 deg bins):\n";
+    for (int i = 0; i < AeroStats::AOA_BINS; ++i) {
+        if (!s.aoa[i]) continue;
+        os << "    [" << std::setw(4) << (-180 + 5 * i) << ", " << std::setw(4) << (-175 + 5 * i) << ") "
+           << s.aoa[i] << " (" << pct(s.aoa[i], s.steps) << "%)\n";
+    }
+
+    // table entries: how many are touched and where the mass sits
+    uint64_t total = 0;
+    int used = 0;
+    for (uint64_t c : s.tableIndex) { total += c; used += c != 0; }
+    os << "  AeroCoeffTable: " << used << " of " << AeroStats::TABLE_BINS << " entries touched";
+    if (total) {
+        os << ", AoA percentiles";
+        for (double q : {0.01, 0.5, 0.99}) {
+            uint64_t target = uint64_t(q * double(total)), run = 0;
+            int i = 0;
+            while (i < AeroStats::TABLE_BINS - 1 && run + s.tableIndex[i] <= target) run += s.tableIndex[i++];
+            os << " p" << int(q * 100) << "=" << (-180.0 + 0.25 * i);
+        }
+    }
+    os << "\n";
+
+    os << "  Airfoil::sample: " << s.polarSamples << " calls, segment index histogram:\n";
+    for (int i = 0; i < AeroStats::SEGMENT_BINS; ++i) {
+        if (!s.segmentIndex[i]) continue;
+        os << "    " << std::setw(4) << i << (i == AeroStats::SEGMENT_BINS - 1 ? "+ " : "  ") << s.segmentIndex[i]
+           << " (" << pct(s.segmentIndex[i], s.polarSamples) << "%)\n";
+    }
+    os.flags(flags);
+}
+
+#else
+
+void aeroStatsDump(std::ostream& os)
+{
+    os << "aero stats disabled (build with -DPHYSICS_AERO_STATS)\n";
+}
+
+#endif // PHYSICS_AERO_STATS
@@ -0,0 +1,220 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#define AIRFOIL_SIMD_X86 1
+#else
+#define AIRFOIL_SIMD_X86 0
+#endif
+
+#if AIRFOIL_SIMD_X86 && defined(__GNUC__)
+#define AIRFOIL_SIMD_AVX2 1   // built with target("avx2"), selected at runtime
+#else
+#define AIRFOIL_SIMD_AVX2 0
+#endif
+
+static_assert(sizeof(PolarSegment) == 8 * sizeof(float), "gather offsets assume 8-float segments");
+static_assert(sizeof(AeroCoeffs) % sizeof(float) == 0, "AoS stride must be whole floats");
+
+// ---------------------------
+// Flat view of an Airfoil's lookup tables for the batch kernels
+// ---------------------------
+namespace {
+struct BatchView {
+    const float* seg;        // PolarSegment array as floats
+    const uint32_t* bracket; // non-uniform bucket -> segment
+    int last_seg;
+    int last_bucket;
+    float min_alpha;
+    float max_alpha;
+    float inv_step;
+    bool uniform;
+};
+
+inline void storeLanes(float* dst, size_t stride, const float* lanes, int count)
+{
+    for (int k = 0; k < count; ++k) dst[k * stride] = lanes[k];
+}
+} // namespace
+
+// ---------------------------
+// AVX2: 8 lanes, gathers for bracket + segment fields
+// ---------------------------
+#if AIRFOIL_SIMD_AVX2
+__attribute__((target("avx2,fma")))
+static size_t batchAVX2(const BatchView& v, const float* alpha, float* Cl, float* Cd, float* Cm,
+                        size_t stride, size_t n)
+{
+    const __m256 vmin = _mm256_set1_ps(v.min_alpha);
+    const __m256 vmax = _mm256_set1_ps(v.max_alpha);
+    const __m256 vinv = _mm256_set1_ps(v.inv_step);
+    const __m256i vlast = _mm256_set1_epi32(v.last_seg);
+    const __m256i vlastb = _mm256_set1_epi32(v.last_bucket);
+    const __m256i one = _mm256_set1_epi32(1);
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(alpha + i), vmin), vmax);
+        __m256i idx = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_sub_ps(a, vmin), vinv));
+
+        if (v.uniform) {
+            idx = _mm256_min_epi32(idx, vlast);
+        } else {
+            idx = _mm256_i32gather_epi32((const int*)v.bracket, _mm256_min_epi32(idx, vlastb), 4);
+            for (;;) {
+                __m256i nxt = _mm256_min_epi32(_mm256_add_epi32(idx, one), vlast);
+                __m256 next_alpha = _mm256_i32gather_ps(v.seg, _mm256_slli_epi32(nxt, 3), 4);
+                __m256i adv = _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(a, next_alpha, _CMP_GE_OQ)),
+                                               _mm256_cmpgt_epi32(vlast, idx));
+                if (_mm256_testz_si256(adv, adv)) break;
+                idx = _mm256_sub_epi32(idx, adv); // adv lanes are -1
+            }
+        }
+
+        __m256i base = _mm256_slli_epi32(idx, 3);
+        __m256 d = _mm256_sub_ps(a, _mm256_i32gather_ps(v.seg, base, 4));
+        __m256 cl = _mm256_fmadd_ps(_mm256_i32gather_ps(v.seg + 4, base, 4), d, _mm256_i32gather_ps(v.seg + 1, base, 4));
+        __m256 cd = _mm256_fmadd_ps(_mm256_i32gather_ps(v.seg + 5, base, 4), d, _mm256_i32gather_ps(v.seg + 2, base, 4));
+        __m256 cm = _mm256_fmadd_ps(_mm256_i32gather_ps(v.seg + 6, base, 4), d, _mm256_i32gather_ps(v.seg + 3, base, 4));
+
+        if (stride == 1) {
+            _mm256_storeu_ps(Cl + i, cl);
+            _mm256_storeu_ps(Cd + i, cd);
+            _mm256_storeu_ps(Cm + i, cm);
+        } else {
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, cl); storeLanes(Cl + i * stride, stride, lanes, 8);
+            _mm256_store_ps(lanes, cd); storeLanes(Cd + i * stride, stride, lanes, 8);
+            _mm256_store_ps(lanes, cm); storeLanes(Cm + i * stride, stride, lanes, 8);
+        }
+    }
+    return i;
+}
+
+static bool cpuHasAVX2()
+{
+    static const bool has = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return has;
+}
+#endif
+
+// ---------------------------
+// SSE: 4 lanes, vector index math, scalar segment fetch (no gathers)
+// ---------------------------
+#if AIRFOIL_SIMD_X86
+static size_t batchSSE(const BatchView& v, const float* alpha, float* Cl, float* Cd, float* Cm,
+                       size_t stride, size_t n)
+{
+    const __m128 vmin = _mm_set1_ps(v.min_alpha);
+    const __m128 vmax = _mm_set1_ps(v.max_alpha);
+    const __m128 vinv = _mm_set1_ps(v.inv_step);
+    const __m128 vcap = _mm_set1_ps(float(v.uniform ? v.last_seg : v.last_bucket));
+    const PolarSegment* segs = reinterpret_cast<const PolarSegment*>(v.seg);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 a = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(alpha + i), vmin), vmax);
+        __m128 u = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(a, vmin), vinv), vcap);
+        alignas(16) int idx[4];
+        alignas(16) float av[4];
+        _mm_store_si128((__m128i*)idx, _mm_cvttps_epi32(u));
+        _mm_store_ps(av, a);
+
+        if (!v.uniform) {
+            for (int k = 0; k < 4; ++k) {
+                int j = int(v.bracket[idx[k]]);
+                while (j < v.last_seg && av[k] >= segs[j + 1].alpha) ++j;
+                idx[k] = j;
+            }
+        }
+
+        const PolarSegment& s0 = segs[idx[0]];
+        const PolarSegment& s1 = segs[idx[1]];
+        const PolarSegment& s2 = segs[idx[2]];
+        const PolarSegment& s3 = segs[idx[3]];
+
+        // transpose the four 8-float records into node/slope columns
+        __m128 lo0 = _mm_load_ps(&s0.alpha), lo1 = _mm_load_ps(&s1.alpha);
+        __m128 lo2 = _mm_load_ps(&s2.alpha), lo3 = _mm_load_ps(&s3.alpha);
+        __m128 hi0 = _mm_load_ps(&s0.dCl), hi1 = _mm_load_ps(&s1.dCl);
+        __m128 hi2 = _mm_load_ps(&s2.dCl), hi3 = _mm_load_ps(&s3.dCl);
+        _MM_TRANSPOSE4_PS(lo0, lo1, lo2, lo3); // alpha, Cl, Cd, Cm
+        _MM_TRANSPOSE4_PS(hi0, hi1, hi2, hi3); // dCl, dCd, dCm, width
+
+        __m128 d = _mm_sub_ps(a, lo0);
+        __m128 cl = _mm_add_ps(lo1, _mm_mul_ps(hi0, d));
+        __m128 cd = _mm_add_ps(lo2, _mm_mul_ps(hi1, d));
+        __m128 cm = _mm_add_ps(lo3, _mm_mul_ps(hi2, d));
+
+        if (stride == 1) {
+            _mm_storeu_ps(Cl + i, cl);
+            _mm_storeu_ps(Cd + i, cd);
+            _mm_storeu_ps(Cm + i, cm);
+        } else {
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, cl); storeLanes(Cl + i * stride, stride, lanes, 4);
+            _mm_store_ps(lanes, cd); storeLanes(Cd + i * stride, stride, lanes, 4);
+            _mm_store_ps(lanes, cm); storeLanes(Cm + i * stride, stride, lanes, 4);
+        }
+    }
+    return i;
+}
+#endif
+
+// ---------------------------
+// Airfoil batch entry points
+// ---------------------------
+void Airfoil::sampleBatchStrided(const float* alpha_deg, float* Cl, float* Cd, float* Cm,
+                                 size_t stride, size_t n) const
+{
+    size_t done = 0;
+    if (n == 0) return;
+
+    const PolarData& p = *polar;
+    if (p.segmentCount != 0 && !p.cubic) {
+        BatchView v;
+        v.seg = &p.segments->alpha;
+        v.bracket = p.bracket;
+        v.last_seg = int(p.segmentCount) - 1;
+        v.last_bucket = p.bracketCount ? int(p.bracketCount) - 1 : 0;
+        v.min_alpha = p.min_alpha;
+        v.max_alpha = p.max_alpha;
+        v.inv_step = p.inv_step;
+        v.uniform = p.uniform;
+
+#if AIRFOIL_SIMD_AVX2
+        if (cpuHasAVX2()) done = batchAVX2(v, alpha_deg, Cl, Cd, Cm, stride, n);
+#endif
+#if AIRFOIL_SIMD_X86
+        done += batchSSE(v, alpha_deg + done, Cl + done * stride, Cd + done * stride, Cm + done * stride,
+                         stride, n - done);
+#endif
+    }
+
+    // scalar tail (and the whole batch on non-x86 targets)
+    for (size_t i = done; i < n; ++i) {
+        AeroCoeffs c = sample(alpha_deg[i]);
+        Cl[i * stride] = c.Cl;
+        Cd[i * stride] = c.Cd;
+        Cm[i * stride] = c.Cm;
+    }
+}
+
+void Airfoil::sampleBatch(const float* alpha_deg, float* Cl, float* Cd, float* Cm, size_t n) const
+{
+    sampleBatchStrided(alpha_deg, Cl, Cd, Cm, 1, n);
+}
+
+void Airfoil::sampleBatch(const float* alpha_deg, AeroCoeffs* out, size_t n) const
+{
+    if (n == 0) return;
+    const size_t stride = sizeof(AeroCoeffs) / sizeof(float);
+    sampleBatchStrided(alpha_deg, &out->Cl, &out->Cd, &out->Cm, stride, n);
+    for (size_t i = 0; i < n; ++i) {
+        out[i].Cl_roll = 0.0f;
+        out[i].Cn_yaw  = 0.0f;
+    }
+}
@@ -0,0 +1,703 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "fleet.h"
+#include "aerostats.h"
+#include "threadpool.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <glm/gtx/quaternion.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#define FLEET_SIMD_X86 1
+#else
+#define FLEET_SIMD_X86 0
+#endif
+
+#if FLEET_SIMD_X86 && defined(__GNUC__)
+#define FLEET_SIMD_AVX2 1     // built with target("avx2"/"avx512f"), selected at runtime
+#define FLEET_SIMD_AVX512 1
+#else
+#define FLEET_SIMD_AVX2 0
+#define FLEET_SIMD_AVX512 0
+#endif
+
+static constexpr float PI_F = 3.14159265358979323846f;
+static constexpr float RAD2DEG = 180.0f / PI_F;
+static constexpr float RHO = 1.225f;
+static constexpr float GRAVITY = -9.81f;
+static constexpr int ENTRY = 4;     // floats per packed coefficient entry (Cl, Cd, Cm, 0)
+static constexpr int ZERO_AOA = int(-AeroCoeffTable::MIN_DEG / AeroCoeffTable::STEP_DEG);
+
+// atan polynomial on [0, 1] (|err| < 1e-5 rad), same sequence as the strip kernels
+static constexpr float ATAN_C1 = 0.99997726f;
+static constexpr float ATAN_C3 = -0.33262347f;
+static constexpr float ATAN_C5 = 0.19354346f;
+static constexpr float ATAN_C7 = -0.11643287f;
+static constexpr float ATAN_C9 = 0.05265332f;
+static constexpr float ATAN_C11 = -0.01172120f;
+
+// ---------------------------
+// AircraftFleet
+// ---------------------------
+void AircraftFleet::reserve(size_t n)
+{
+    for (auto* col : {&px, &py, &pz, &vx, &vy, &vz, &qw, &qx, &qy, &qz, &wx, &wy, &wz, &mass,
+                      &Ixx, &Iyy, &Izz, &IxxInv, &IyyInv, &IzzInv, &wingArea, &wingspan, &chord, &thrust})
+        col->reserve(n);
+    type.reserve(n);
+}
+
+long AircraftFleet::add(const Aircraft& plane)
+{
+    if (plane.stability || plane.strips || plane.lattice) {
+        std::cerr << "AircraftFleet: only the lumped model is supported (no stability table, strips or lattice)\n";
+        return -1;
+    }
+    if (plane.orientationUpdate != OrientationUpdate::Linear) {
+        std::cerr << "AircraftFleet: only the linear orientation update is supported\n";
+        return -1;
+    }
+
+    // same table updatePhysics would use for this wing and airfoil
+    const float AR = (plane.wingArea > 1e-6f) ? (plane.wingspan * plane.wingspan / plane.wingArea) : 1.0f;
+    const AirfoilProperties& props = plane.airfoil.properties();
+    std::shared_ptr<const AeroCoeffTable> table = plane.aeroTable;
+    if (!table || !table->matches(AR, props)) table = acquireAeroCoeffTable(AR, props);
+
+    uint32_t t = 0;
+    while (t < types.size() && types[t].table != table) ++t;
+    if (t == types.size()) {
+        types.push_back({table, props.stallDeg});
+        for (const AeroCoeffs& c : table->entries)
+            coeffs.insert(coeffs.end(), {c.Cl, c.Cd, c.Cm, 0.0f});
+    }
+
+    px.push_back(plane.position.x); py.push_back(plane.position.y); pz.push_back(plane.position.z);
+    vx.push_back(plane.velocity.x); vy.push_back(plane.velocity.y); vz.push_back(plane.velocity.z);
+    qw.push_back(plane.orientation.w); qx.push_back(plane.orientation.x);
+    qy.push_back(plane.orientation.y); qz.push_back(plane.orientation.z);
+    wx.push_back(plane.angularVelocity.x); wy.push_back(plane.angularVelocity.y); wz.push_back(plane.angularVelocity.z);
+    mass.push_back(plane.mass);
+    Ixx.push_back(plane.inertia.x); Iyy.push_back(plane.inertia.y); Izz.push_back(plane.inertia.z);
+    IxxInv.push_back(plane.inertiaInv.x); IyyInv.push_back(plane.inertiaInv.y); IzzInv.push_back(plane.inertiaInv.z);
+    wingArea.push_back(plane.wingArea);
+    wingspan.push_back(plane.wingspan);
+    chord.push_back(plane.chord);
+    thrust.push_back(plane.thrust);
+    type.push_back(t);
+    return long(px.size() - 1);
+}
+
+void AircraftFleet::read(size_t i, Aircraft& plane) const
+{
+    plane.position = glm::vec3(px[i], py[i], pz[i]);
+    plane.velocity = glm::vec3(vx[i], vy[i], vz[i]);
+    plane.orientation = glm::quat(qw[i], qx[i], qy[i], qz[i]);
+    plane.angularVelocity = glm::vec3(wx[i], wy[i], wz[i]);
+    plane.thrust = thrust[i];
+}
+
+// ---------------------------
+// Scalar kernel: the lumped path of updatePhysics, column by column (also
+// the tail of the vector kernels)
+// ---------------------------
+static void stepScalar(AircraftFleet& f, size_t begin, size_t end, float dt)
+{
+    const float rho = RHO;
+    const glm::vec3 gravity_world(0.0f, GRAVITY, 0.0f);
+
+    for (size_t i = begin; i < end; ++i) {
+        const glm::quat q(f.qw[i], f.qx[i], f.qy[i], f.qz[i]);
+        const glm::vec3 vel(f.vx[i], f.vy[i], f.vz[i]);
+        const AircraftFleet::Type& type = f.types[f.type[i]];
+
+        // 1) kinematics
+        glm::vec3 vel_body = glm::vec3(glm::conjugate(q) * glm::vec4(vel, 0.0f));
+        float V = glm::length(vel);
+        if (V < 1e-6f) V = 1e-6f;
+        float aoa_deg = roundToQuarter(std::atan2(vel_body.y, vel_body.x) * RAD2DEG);
+
+        // 2) coefficients
+        const AeroCoeffs& coeffs = type.table->lookup(aoa_deg);
+        AERO_STAT(++stats.steps;
+                  ++stats.aoa[AeroStats::aoaBin(aoa_deg)];
+                  ++(std::fabs(aoa_deg) <= type.stallDeg ? stats.linear : stats.postStall));
+
+        // 3) forces
+        const float qdyn = 0.5f * rho * V * V;
+        const float S = f.wingArea[i];
+        glm::vec3 v_body_norm = glm::normalize(vel_body);
+        glm::vec3 liftDir_body = glm::cross(glm::cross(v_body_norm, glm::vec3(0.0f, 0.0f, 1.0f)), v_body_norm);
+        if (glm::length(liftDir_body) < 1e-6f) {
+            AERO_STAT(++stats.liftDirFallback);
+            liftDir_body = glm::vec3(0.0f, 1.0f, 0.0f);
+        } else {
+            liftDir_body = glm::normalize(liftDir_body);
+        }
+        glm::vec3 lift_body = liftDir_body * (qdyn * S * coeffs.Cl);
+        glm::vec3 drag_body = -v_body_norm * (qdyn * S * coeffs.Cd);
+        glm::vec3 thrust_body = glm::vec3(1.0f, 0.0f, 0.0f) * f.thrust[i];
+
+        glm::vec3 lift_world = glm::vec3(q * glm::vec4(lift_body, 0.0f));
+        glm::vec3 drag_world = glm::vec3(q * glm::vec4(drag_body, 0.0f));
+        glm::vec3 thrust_world = glm::vec3(q * glm::vec4(thrust_body, 0.0f));
+
+        const float m = f.mass[i];
+        glm::vec3 acc = (lift_world + drag_world + thrust_world + gravity_world * m) / m;
+        glm::vec3 v = vel + acc * dt;
+        f.vx[i] = v.x; f.vy[i] = v.y; f.vz[i] = v.z;
+        f.px[i] += v.x * dt; f.py[i] += v.y * dt; f.pz[i] += v.z * dt;
+
+        // 4) moments (pitch only in the lumped model)
+        glm::vec3 M(coeffs.Cl_roll * qdyn * S * f.wingspan[i],
+                    coeffs.Cm * qdyn * S * f.chord[i],
+                    coeffs.Cn_yaw * qdyn * S * f.wingspan[i]);
+
+        // 5) Euler's equations, diagonal inertia
+        glm::vec3 w(f.wx[i], f.wy[i], f.wz[i]);
+        glm::vec3 Iw(f.Ixx[i] * w.x, f.Iyy[i] * w.y, f.Izz[i] * w.z);
+        glm::vec3 gyro = glm::cross(w, Iw);
+        w.x += f.IxxInv[i] * (M.x - gyro.x) * dt;
+        w.y += f.IyyInv[i] * (M.y - gyro.y) * dt;
+        w.z += f.IzzInv[i] * (M.z - gyro.z) * dt;
+        f.wx[i] = w.x; f.wy[i] = w.y; f.wz[i] = w.z;
+
+        // 6) quaternion update
+        glm::quat qdot = 0.5f * (q * glm::quat(0.0f, w.x, w.y, w.z));
+        glm::quat qn = glm::normalize(q + qdot * dt);
+        f.qw[i] = qn.w; f.qx[i] = qn.x; f.qy[i] = qn.y; f.qz[i] = qn.z;
+    }
+}
+
+#ifdef PHYSICS_AERO_STATS
+// per-lane counters for the vector kernels, from the table index each lane used
+static void recordLanes(const AircraftFleet& f, size_t i, const int* k, unsigned fallback, int lanes)
+{
+    AeroStats& stats = aeroStatsLocal();
+    for (int l = 0; l < lanes; ++l) {
+        float aoa_deg = AeroCoeffTable::MIN_DEG + float(k[l]) * AeroCoeffTable::STEP_DEG;
+        ++stats.steps;
+        ++stats.aoa[AeroStats::aoaBin(aoa_deg)];
+        ++(std::fabs(aoa_deg) <= f.types[f.type[i + l]].stallDeg ? stats.linear : stats.postStall);
+        ++stats.tableIndex[k[l]];
+        if ((fallback >> l) & 1u) ++stats.liftDirFallback;
+    }
+}
+#endif
+
+// ---------------------------
+// AVX2: 8 aircraft per iteration, gathered table entries
+// ---------------------------
+#if FLEET_SIMD_AVX2
+__attribute__((target("avx2,fma")))
+static inline __m256 rsqrt256(__m256 x)
+{
+    // hardware estimate (12 bits) + one Newton step
+    __m256 y = _mm256_rsqrt_ps(x);
+    __m256 xyy = _mm256_mul_ps(_mm256_mul_ps(x, y), y);
+    return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), y), _mm256_sub_ps(_mm256_set1_ps(3.0f), xyy));
+}
+
+__attribute__((target("avx2,fma")))
+static inline __m256 atan2_256(__m256 y, __m256 x)
+{
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    __m256 ax = _mm256_andnot_ps(signMask, x), ay = _mm256_andnot_ps(signMask, y);
+    __m256 a = _mm256_div_ps(_mm256_min_ps(ax, ay), _mm256_max_ps(_mm256_max_ps(ax, ay), _mm256_set1_ps(1e-30f)));
+    __m256 s = _mm256_mul_ps(a, a);
+    __m256 poly = _mm256_fmadd_ps(_mm256_set1_ps(ATAN_C11), s, _mm256_set1_ps(ATAN_C9));
+    poly = _mm256_fmadd_ps(poly, s, _mm256_set1_ps(ATAN_C7));
+    poly = _mm256_fmadd_ps(poly, s, _mm256_set1_ps(ATAN_C5));
+    poly = _mm256_fmadd_ps(poly, s, _mm256_set1_ps(ATAN_C3));
+    __m256 r = _mm256_mul_ps(_mm256_fmadd_ps(poly, s, _mm256_set1_ps(ATAN_C1)), a);
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(0.5f * PI_F), r), _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(PI_F), r), _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+    return _mm256_or_ps(r, _mm256_and_ps(y, signMask));
+}
+
+// v <- q v q* for unit q: v + 2w (u x v) + 2 u x (u x v)
+__attribute__((target("avx2,fma")))
+static inline void rotate256(__m256 qw, __m256 qx, __m256 qy, __m256 qz, __m256& x, __m256& y, __m256& z)
+{
+    __m256 tx = _mm256_fmsub_ps(qy, z, _mm256_mul_ps(qz, y));
+    __m256 ty = _mm256_fmsub_ps(qz, x, _mm256_mul_ps(qx, z));
+    __m256 tz = _mm256_fmsub_ps(qx, y, _mm256_mul_ps(qy, x));
+    __m256 ux = _mm256_fmsub_ps(qy, tz, _mm256_mul_ps(qz, ty));
+    __m256 uy = _mm256_fmsub_ps(qz, tx, _mm256_mul_ps(qx, tz));
+    __m256 uz = _mm256_fmsub_ps(qx, ty, _mm256_mul_ps(qy, tx));
+    const __m256 two = _mm256_set1_ps(2.0f);
+    x = _mm256_fmadd_ps(two, _mm256_fmadd_ps(qw, tx, ux), x);
+    y = _mm256_fmadd_ps(two, _mm256_fmadd_ps(qw, ty, uy), y);
+    z = _mm256_fmadd_ps(two, _mm256_fmadd_ps(qw, tz, uz), z);
+}
+
+__attribute__((target("avx2,fma")))
+static size_t stepAVX2(AircraftFleet& f, size_t begin, size_t end, float dt)
+{
+    const __m256 vdt = _mm256_set1_ps(dt), halfDt = _mm256_set1_ps(0.5f * dt);
+    const __m256 halfRho = _mm256_set1_ps(0.5f * RHO), g = _mm256_set1_ps(GRAVITY);
+    const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f), signMask = _mm256_set1_ps(-0.0f);
+    const __m256 tiny = _mm256_set1_ps(1e-12f);
+    const __m256 toIndex = _mm256_set1_ps(RAD2DEG / AeroCoeffTable::STEP_DEG);
+    const __m256i zeroAoa = _mm256_set1_epi32(ZERO_AOA), lastK = _mm256_set1_epi32(AeroCoeffTable::SIZE - 1);
+    const __m256i tableSize = _mm256_set1_epi32(AeroCoeffTable::SIZE);
+    const float* coeffs = f.coeffs.data();
+
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const __m256 qw = _mm256_load_ps(&f.qw[i]), qx = _mm256_load_ps(&f.qx[i]);
+        const __m256 qy = _mm256_load_ps(&f.qy[i]), qz = _mm256_load_ps(&f.qz[i]);
+        __m256 vx = _mm256_load_ps(&f.vx[i]), vy = _mm256_load_ps(&f.vy[i]), vz = _mm256_load_ps(&f.vz[i]);
+
+        // 1) world -> body velocity (rotation by the conjugate)
+        __m256 bx = vx, by = vy, bz = vz;
+        rotate256(qw, _mm256_xor_ps(qx, signMask), _mm256_xor_ps(qy, signMask), _mm256_xor_ps(qz, signMask), bx, by, bz);
+        __m256 V2 = _mm256_max_ps(_mm256_fmadd_ps(vx, vx, _mm256_fmadd_ps(vy, vy, _mm256_mul_ps(vz, vz))), tiny);
+        __m256 inv = rsqrt256(_mm256_max_ps(_mm256_fmadd_ps(bx, bx, _mm256_fmadd_ps(by, by, _mm256_mul_ps(bz, bz))), tiny));
+        __m256 nx = _mm256_mul_ps(bx, inv), ny = _mm256_mul_ps(by, inv), nz = _mm256_mul_ps(bz, inv);
+
+        // 2) AoA rounded onto the quarter-degree table
+        __m256i k = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(atan2_256(by, bx), toIndex)), zeroAoa);
+        k = _mm256_max_epi32(_mm256_min_epi32(k, lastK), _mm256_setzero_si256());
+        __m256i e = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_load_si256((const __m256i*)&f.type[i]), tableSize), k);
+        e = _mm256_slli_epi32(e, 2);
+        __m256 cl = _mm256_i32gather_ps(coeffs + 0, e, 4);
+        __m256 cd = _mm256_i32gather_ps(coeffs + 1, e, 4);
+        __m256 cm = _mm256_i32gather_ps(coeffs + 2, e, 4);
+
+        // 3) lift + drag + thrust summed in body axes, one rotation to world
+        __m256 qS = _mm256_mul_ps(_mm256_mul_ps(halfRho, V2), _mm256_load_ps(&f.wingArea[i]));
+        __m256 h = _mm256_fmadd_ps(nx, nx, _mm256_mul_ps(ny, ny));
+        __m256 fallback = _mm256_cmp_ps(h, tiny, _CMP_LT_OQ);
+        __m256 invH = _mm256_xor_ps(rsqrt256(_mm256_max_ps(h, tiny)), signMask);
+        __m256 lx = _mm256_blendv_ps(_mm256_mul_ps(_mm256_mul_ps(nx, nz), invH), zero, fallback);
+        __m256 ly = _mm256_blendv_ps(_mm256_mul_ps(_mm256_mul_ps(ny, nz), invH), one, fallback);
+        __m256 lz = _mm256_blendv_ps(_mm256_xor_ps(_mm256_mul_ps(h, invH), signMask), zero, fallback);
+        __m256 L = _mm256_mul_ps(qS, cl), D = _mm256_mul_ps(qS, cd);
+        __m256 Fx = _mm256_add_ps(_mm256_fmsub_ps(lx, L, _mm256_mul_ps(nx, D)), _mm256_load_ps(&f.thrust[i]));
+        __m256 Fy = _mm256_fmsub_ps(ly, L, _mm256_mul_ps(ny, D));
+        __m256 Fz = _mm256_fmsub_ps(lz, L, _mm256_mul_ps(nz, D));
+        rotate256(qw, qx, qy, qz, Fx, Fy, Fz);
+
+        // semi-implicit Euler
+        __m256 invM = _mm256_div_ps(one, _mm256_load_ps(&f.mass[i]));
+        vx = _mm256_fmadd_ps(_mm256_mul_ps(Fx, invM), vdt, vx);
+        vy = _mm256_fmadd_ps(_mm256_fmadd_ps(Fy, invM, g), vdt, vy);
+        vz = _mm256_fmadd_ps(_mm256_mul_ps(Fz, invM), vdt, vz);
+        _mm256_store_ps(&f.vx[i], vx); _mm256_store_ps(&f.vy[i], vy); _mm256_store_ps(&f.vz[i], vz);
+        _mm256_store_ps(&f.px[i], _mm256_fmadd_ps(vx, vdt, _mm256_load_ps(&f.px[i])));
+        _mm256_store_ps(&f.py[i], _mm256_fmadd_ps(vy, vdt, _mm256_load_ps(&f.py[i])));
+        _mm256_store_ps(&f.pz[i], _mm256_fmadd_ps(vz, vdt, _mm256_load_ps(&f.pz[i])));
+
+        // 4-5) pitch moment, Euler's equations
+        __m256 My = _mm256_mul_ps(_mm256_mul_ps(cm, qS), _mm256_load_ps(&f.chord[i]));
+        __m256 wx = _mm256_load_ps(&f.wx[i]), wy = _mm256_load_ps(&f.wy[i]), wz = _mm256_load_ps(&f.wz[i]);
+        __m256 Ix = _mm256_mul_ps(_mm256_load_ps(&f.Ixx[i]), wx);
+        __m256 Iy = _mm256_mul_ps(_mm256_load_ps(&f.Iyy[i]), wy);
+        __m256 Iz = _mm256_mul_ps(_mm256_load_ps(&f.Izz[i]), wz);
+        __m256 gx = _mm256_fmsub_ps(wy, Iz, _mm256_mul_ps(wz, Iy));
+        __m256 gy = _mm256_fmsub_ps(wz, Ix, _mm256_mul_ps(wx, Iz));
+        __m256 gz = _mm256_fmsub_ps(wx, Iy, _mm256_mul_ps(wy, Ix));
+        wx = _mm256_fnmadd_ps(_mm256_mul_ps(_mm256_load_ps(&f.IxxInv[i]), gx), vdt, wx);
+        wy = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_load_ps(&f.IyyInv[i]), _mm256_sub_ps(My, gy)), vdt, wy);
+        wz = _mm256_fnmadd_ps(_mm256_mul_ps(_mm256_load_ps(&f.IzzInv[i]), gz), vdt, wz);
+        _mm256_store_ps(&f.wx[i], wx); _mm256_store_ps(&f.wy[i], wy); _mm256_store_ps(&f.wz[i], wz);
+
+        // 6) q += dt/2 q (0, w), renormalized
+        __m256 dw = _mm256_fmadd_ps(qx, wx, _mm256_fmadd_ps(qy, wy, _mm256_mul_ps(qz, wz)));
+        __m256 dx = _mm256_fmadd_ps(qw, wx, _mm256_fmsub_ps(qy, wz, _mm256_mul_ps(qz, wy)));
+        __m256 dy = _mm256_fmadd_ps(qw, wy, _mm256_fmsub_ps(qz, wx, _mm256_mul_ps(qx, wz)));
+        __m256 dz = _mm256_fmadd_ps(qw, wz, _mm256_fmsub_ps(qx, wy, _mm256_mul_ps(qy, wx)));
+        __m256 nw = _mm256_fnmadd_ps(halfDt, dw, qw), nqx = _mm256_fmadd_ps(halfDt, dx, qx);
+        __m256 nqy = _mm256_fmadd_ps(halfDt, dy, qy), nqz = _mm256_fmadd_ps(halfDt, dz, qz);
+        __m256 qn = rsqrt256(_mm256_fmadd_ps(nw, nw, _mm256_fmadd_ps(nqx, nqx, _mm256_fmadd_ps(nqy, nqy, _mm256_mul_ps(nqz, nqz)))));
+        _mm256_store_ps(&f.qw[i], _mm256_mul_ps(nw, qn)); _mm256_store_ps(&f.qx[i], _mm256_mul_ps(nqx, qn));
+        _mm256_store_ps(&f.qy[i], _mm256_mul_ps(nqy, qn)); _mm256_store_ps(&f.qz[i], _mm256_mul_ps(nqz, qn));
+
+#ifdef PHYSICS_AERO_STATS
+        alignas(32) int lanes[8];
+        _mm256_store_si256((__m256i*)lanes, k);
+        recordLanes(f, i, lanes, unsigned(_mm256_movemask_ps(fallback)), 8);
+#endif
+    }
+    return i;
+}
+
+static bool cpuHasAVX2()
+{
+    static const bool has = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return has;
+}
+#endif
+
+// ---------------------------
+// AVX-512: 16 aircraft per iteration, mask blends
+// ---------------------------
+#if FLEET_SIMD_AVX512
+// GCC's unmasked forms of these intrinsics merge into _mm512_undefined_*(),
+// which -Wmaybe-uninitialized flags once inlined; the maskz / mask forms
+// with every lane selected are the same instructions on a zeroed source
+static constexpr __mmask16 ALL16 = 0xFFFF;
+
+__attribute__((target("avx512f")))
+static inline __m512 rsqrt512(__m512 x)
+{
+    // 14-bit estimate + one Newton step
+    __m512 y = _mm512_maskz_rsqrt14_ps(ALL16, x);
+    __m512 xyy = _mm512_mul_ps(_mm512_mul_ps(x, y), y);
+    return _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(0.5f), y), _mm512_sub_ps(_mm512_set1_ps(3.0f), xyy));
+}
+
+__attribute__((target("avx512f")))
+static inline __m512 atan2_512(__m512 y, __m512 x)
+{
+    __m512 ax = _mm512_abs_ps(x), ay = _mm512_abs_ps(y);
+    __m512 a = _mm512_div_ps(_mm512_maskz_min_ps(ALL16, ax, ay), _mm512_maskz_max_ps(ALL16, _mm512_maskz_max_ps(ALL16, ax, ay), _mm512_set1_ps(1e-30f)));
+    __m512 s = _mm512_mul_ps(a, a);
+    __m512 poly = _mm512_fmadd_ps(_mm512_set1_ps(ATAN_C11), s, _mm512_set1_ps(ATAN_C9));
+    poly = _mm512_fmadd_ps(poly, s, _mm512_set1_ps(ATAN_C7));
+    poly = _mm512_fmadd_ps(poly, s, _mm512_set1_ps(ATAN_C5));
+    poly = _mm512_fmadd_ps(poly, s, _mm512_set1_ps(ATAN_C3));
+    __m512 r = _mm512_mul_ps(_mm512_fmadd_ps(poly, s, _mm512_set1_ps(ATAN_C1)), a);
+    r = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(ay, ax, _CMP_GT_OQ), r, _mm512_sub_ps(_mm512_set1_ps(0.5f * PI_F), r));
+    r = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_LT_OQ), r,
+                             _mm512_sub_ps(_mm512_set1_ps(PI_F), r));
+    const __m512i signBit = _mm512_set1_epi32(int(0x80000000u));
+    return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(r),
+                                               _mm512_and_si512(_mm512_castps_si512(y), signBit)));
+}
+
+__attribute__((target("avx512f")))
+static inline void rotate512(__m512 qw, __m512 qx, __m512 qy, __m512 qz, __m512& x, __m512& y, __m512& z)
+{
+    __m512 tx = _mm512_fmsub_ps(qy, z, _mm512_mul_ps(qz, y));
+    __m512 ty = _mm512_fmsub_ps(qz, x, _mm512_mul_ps(qx, z));
+    __m512 tz = _mm512_fmsub_ps(qx, y, _mm512_mul_ps(qy, x));
+    __m512 ux = _mm512_fmsub_ps(qy, tz, _mm512_mul_ps(qz, ty));
+    __m512 uy = _mm512_fmsub_ps(qz, tx, _mm512_mul_ps(qx, tz));
+    __m512 uz = _mm512_fmsub_ps(qx, ty, _mm512_mul_ps(qy, tx));
+    const __m512 two = _mm512_set1_ps(2.0f);
+    x = _mm512_fmadd_ps(two, _mm512_fmadd_ps(qw, tx, ux), x);
+    y = _mm512_fmadd_ps(two, _mm512_fmadd_ps(qw, ty, uy), y);
+    z = _mm512_fmadd_ps(two, _mm512_fmadd_ps(qw, tz, uz), z);
+}
+
+__attribute__((target("avx512f")))
+static size_t stepAVX512(AircraftFleet& f, size_t begin, size_t end, float dt)
+{
+    const __m512 vdt = _mm512_set1_ps(dt), halfDt = _mm512_set1_ps(0.5f * dt);
+    const __m512 halfRho = _mm512_set1_ps(0.5f * RHO), g = _mm512_set1_ps(GRAVITY);
+    const __m512 zero = _mm512_setzero_ps(), one = _mm512_set1_ps(1.0f);
+    const __m512 tiny = _mm512_set1_ps(1e-12f);
+    const __m512 toIndex = _mm512_set1_ps(RAD2DEG / AeroCoeffTable::STEP_DEG);
+    const __m512i zeroAoa = _mm512_set1_epi32(ZERO_AOA), lastK = _mm512_set1_epi32(AeroCoeffTable::SIZE - 1);
+    const __m512i tableSize = _mm512_set1_epi32(AeroCoeffTable::SIZE);
+    const float* coeffs = f.coeffs.data();
+
+    size_t i = begin;
+    for (; i + 16 <= end; i += 16) {
+        const __m512 qw = _mm512_load_ps(&f.qw[i]), qx = _mm512_load_ps(&f.qx[i]);
+        const __m512 qy = _mm512_load_ps(&f.qy[i]), qz = _mm512_load_ps(&f.qz[i]);
+        __m512 vx = _mm512_load_ps(&f.vx[i]), vy = _mm512_load_ps(&f.vy[i]), vz = _mm512_load_ps(&f.vz[i]);
+
+        // 1) world -> body velocity (rotation by the conjugate)
+        __m512 bx = vx, by = vy, bz = vz;
+        rotate512(qw, _mm512_sub_ps(zero, qx), _mm512_sub_ps(zero, qy), _mm512_sub_ps(zero, qz), bx, by, bz);
+        __m512 V2 = _mm512_maskz_max_ps(ALL16, _mm512_fmadd_ps(vx, vx, _mm512_fmadd_ps(vy, vy, _mm512_mul_ps(vz, vz))), tiny);
+        __m512 inv = rsqrt512(_mm512_maskz_max_ps(ALL16, _mm512_fmadd_ps(bx, bx, _mm512_fmadd_ps(by, by, _mm512_mul_ps(bz, bz))), tiny));
+        __m512 nx = _mm512_mul_ps(bx, inv), ny = _mm512_mul_ps(by, inv), nz = _mm512_mul_ps(bz, inv);
+
+        // 2) AoA rounded onto the quarter-degree table
+        __m512i k = _mm512_add_epi32(_mm512_maskz_cvtps_epi32(ALL16, _mm512_mul_ps(atan2_512(by, bx), toIndex)), zeroAoa);
+        k = _mm512_maskz_max_epi32(ALL16, _mm512_maskz_min_epi32(ALL16, k, lastK), _mm512_setzero_si512());
+        __m512i e = _mm512_add_epi32(_mm512_mullo_epi32(_mm512_load_si512(&f.type[i]), tableSize), k);
+        e = _mm512_maskz_slli_epi32(ALL16, e, 2);
+        __m512 cl = _mm512_mask_i32gather_ps(zero, ALL16, e, coeffs + 0, 4);
+        __m512 cd = _mm512_mask_i32gather_ps(zero, ALL16, e, coeffs + 1, 4);
+        __m512 cm = _mm512_mask_i32gather_ps(zero, ALL16, e, coeffs + 2, 4);
+
+        // 3) lift + drag + thrust summed in body axes, one rotation to world
+        __m512 qS = _mm512_mul_ps(_mm512_mul_ps(halfRho, V2), _mm512_load_ps(&f.wingArea[i]));
+        __m512 h = _mm512_fmadd_ps(nx, nx, _mm512_mul_ps(ny, ny));
+        __mmask16 fallback = _mm512_cmp_ps_mask(h, tiny, _CMP_LT_OQ);
+        __m512 invH = _mm512_sub_ps(zero, rsqrt512(_mm512_maskz_max_ps(ALL16, h, tiny)));
+        __m512 lx = _mm512_mask_blend_ps(fallback, _mm512_mul_ps(_mm512_mul_ps(nx, nz), invH), zero);
+        __m512 ly = _mm512_mask_blend_ps(fallback, _mm512_mul_ps(_mm512_mul_ps(ny, nz), invH), one);
+        __m512 lz = _mm512_mask_blend_ps(fallback, _mm512_sub_ps(zero, _mm512_mul_ps(h, invH)), zero);
+        __m512 L = _mm512_mul_ps(qS, cl), D = _mm512_mul_ps(qS, cd);
+        __m512 Fx = _mm512_add_ps(_mm512_fmsub_ps(lx, L, _mm512_mul_ps(nx, D)), _mm512_load_ps(&f.thrust[i]));
+        __m512 Fy = _mm512_fmsub_ps(ly, L, _mm512_mul_ps(ny, D));
+        __m512 Fz = _mm512_fmsub_ps(lz, L, _mm512_mul_ps(nz, D));
+        rotate512(qw, qx, qy, qz, Fx, Fy, Fz);
+
+        // semi-implicit Euler
+        __m512 invM = _mm512_div_ps(one, _mm512_load_ps(&f.mass[i]));
+        vx = _mm512_fmadd_ps(_mm512_mul_ps(Fx, invM), vdt, vx);
+        vy = _mm512_fmadd_ps(_mm512_fmadd_ps(Fy, invM, g), vdt, vy);
+        vz = _mm512_fmadd_ps(_mm512_mul_ps(Fz, invM), vdt, vz);
+        _mm512_store_ps(&f.vx[i], vx); _mm512_store_ps(&f.vy[i], vy); _mm512_store_ps(&f.vz[i], vz);
+        _mm512_store_ps(&f.px[i], _mm512_fmadd_ps(vx, vdt, _mm512_load_ps(&f.px[i])));
+        _mm512_store_ps(&f.py[i], _mm512_fmadd_ps(vy, vdt, _mm512_load_ps(&f.py[i])));
+        _mm512_store_ps(&f.pz[i], _mm512_fmadd_ps(vz, vdt, _mm512_load_ps(&f.pz[i])));
+
+        // 4-5) pitch moment, Euler's equations
+        __m512 My = _mm512_mul_ps(_mm512_mul_ps(cm, qS), _mm512_load_ps(&f.chord[i]));
+        __m512 wx = _mm512_load_ps(&f.wx[i]), wy = _mm512_load_ps(&f.wy[i]), wz = _mm512_load_ps(&f.wz[i]);
+        __m512 Ix = _mm512_mul_ps(_mm512_load_ps(&f.Ixx[i]), wx);
+        __m512 Iy = _mm512_mul_ps(_mm512_load_ps(&f.Iyy[i]), wy);
+        __m512 Iz = _mm512_mul_ps(_mm512_load_ps(&f.Izz[i]), wz);
+        __m512 gx = _mm512_fmsub_ps(wy, Iz, _mm512_mul_ps(wz, Iy));
+        __m512 gy = _mm512_fmsub_ps(wz, Ix, _mm512_mul_ps(wx, Iz));
+        __m512 gz = _mm512_fmsub_ps(wx, Iy, _mm512_mul_ps(wy, Ix));
+        wx = _mm512_fnmadd_ps(_mm512_mul_ps(_mm512_load_ps(&f.IxxInv[i]), gx), vdt, wx);
+        wy = _mm512_fmadd_ps(_mm512_mul_ps(_mm512_load_ps(&f.IyyInv[i]), _mm512_sub_ps(My, gy)), vdt, wy);
+        wz = _mm512_fnmadd_ps(_mm512_mul_ps(_mm512_load_ps(&f.IzzInv[i]), gz), vdt, wz);
+        _mm512_store_ps(&f.wx[i], wx); _mm512_store_ps(&f.wy[i], wy); _mm512_store_ps(&f.wz[i], wz);
+
+        // 6) q += dt/2 q (0, w), renormalized
+        __m512 dw = _mm512_fmadd_ps(qx, wx, _mm512_fmadd_ps(qy, wy, _mm512_mul_ps(qz, wz)));
+        __m512 dx = _mm512_fmadd_ps(qw, wx, _mm512_fmsub_ps(qy, wz, _mm512_mul_ps(qz, wy)));
+        __m512 dy = _mm512_fmadd_ps(qw, wy, _mm512_fmsub_ps(qz, wx, _mm512_mul_ps(qx, wz)));
+        __m512 dz = _mm512_fmadd_ps(qw, wz, _mm512_fmsub_ps(qx, wy, _mm512_mul_ps(qy, wx)));
+        __m512 nw = _mm512_fnmadd_ps(halfDt, dw, qw), nqx = _mm512_fmadd_ps(halfDt, dx, qx);
+        __m512 nqy = _mm512_fmadd_ps(halfDt, dy, qy), nqz = _mm512_fmadd_ps(halfDt, dz, qz);
+        __m512 qn = rsqrt512(_mm512_fmadd_ps(nw, nw, _mm512_fmadd_ps(nqx, nqx, _mm512_fmadd_ps(nqy, nqy, _mm512_mul_ps(nqz, nqz)))));
+        _mm512_store_ps(&f.qw[i], _mm512_mul_ps(nw, qn)); _mm512_store_ps(&f.qx[i], _mm512_mul_ps(nqx, qn));
+        _mm512_store_ps(&f.qy[i], _mm512_mul_ps(nqy, qn)); _mm512_store_ps(&f.qz[i], _mm512_mul_ps(nqz, qn));
+
+#ifdef PHYSICS_AERO_STATS
+        alignas(64) int lanes[16];
+        _mm512_store_si512(lanes, k);
+        recordLanes(f, i, lanes, unsigned(fallback), 16);
+#endif
+    }
+    return i;
+}
+
+static bool cpuHasAVX512()
+{
+    static const bool has = __builtin_cpu_supports("avx512f");
+    return has;
+}
+#endif
+
+// ---------------------------
+// SSE: 4 aircraft per iteration, table entries fetched and transposed
+// ---------------------------
+#if FLEET_SIMD_X86
+static inline __m128 selectSSE(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, a));
+}
+
+static inline __m128 rsqrt128(__m128 x)
+{
+    __m128 y = _mm_rsqrt_ps(x);
+    __m128 xyy = _mm_mul_ps(_mm_mul_ps(x, y), y);
+    return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3.0f), xyy));
+}
+
+static inline __m128 atan2_128(__m128 y, __m128 x)
+{
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 ax = _mm_andnot_ps(signMask, x), ay = _mm_andnot_ps(signMask, y);
+    __m128 a = _mm_div_ps(_mm_min_ps(ax, ay), _mm_max_ps(_mm_max_ps(ax, ay), _mm_set1_ps(1e-30f)));
+    __m128 s = _mm_mul_ps(a, a);
+    __m128 poly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(ATAN_C11), s), _mm_set1_ps(ATAN_C9));
+    poly = _mm_add_ps(_mm_mul_ps(poly, s), _mm_set1_ps(ATAN_C7));
+    poly = _mm_add_ps(_mm_mul_ps(poly, s), _mm_set1_ps(ATAN_C5));
+    poly = _mm_add_ps(_mm_mul_ps(poly, s), _mm_set1_ps(ATAN_C3));
+    __m128 r = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(poly, s), _mm_set1_ps(ATAN_C1)), a);
+    r = selectSSE(_mm_cmpgt_ps(ay, ax), r, _mm_sub_ps(_mm_set1_ps(0.5f * PI_F), r));
+    r = selectSSE(_mm_cmplt_ps(x, _mm_setzero_ps()), r, _mm_sub_ps(_mm_set1_ps(PI_F), r));
+    return _mm_or_ps(r, _mm_and_ps(y, signMask));
+}
+
+static inline void rotate128(__m128 qw, __m128 qx, __m128 qy, __m128 qz, __m128& x, __m128& y, __m128& z)
+{
+    __m128 tx = _mm_sub_ps(_mm_mul_ps(qy, z), _mm_mul_ps(qz, y));
+    __m128 ty = _mm_sub_ps(_mm_mul_ps(qz, x), _mm_mul_ps(qx, z));
+    __m128 tz = _mm_sub_ps(_mm_mul_ps(qx, y), _mm_mul_ps(qy, x));
+    __m128 ux = _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty));
+    __m128 uy = _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz));
+    __m128 uz = _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx));
+    const __m128 two = _mm_set1_ps(2.0f);
+    x = _mm_add_ps(x, _mm_mul_ps(two, _mm_add_ps(_mm_mul_ps(qw, tx), ux)));
+    y = _mm_add_ps(y, _mm_mul_ps(two, _mm_add_ps(_mm_mul_ps(qw, ty), uy)));
+    z = _mm_add_ps(z, _mm_mul_ps(two, _mm_add_ps(_mm_mul_ps(qw, tz), uz)));
+}
+
+static size_t stepSSE(AircraftFleet& f, size_t begin, size_t end, float dt)
+{
+    const __m128 vdt = _mm_set1_ps(dt), halfDt = _mm_set1_ps(0.5f * dt);
+    const __m128 halfRho = _mm_set1_ps(0.5f * RHO), g = _mm_set1_ps(GRAVITY);
+    const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), signMask = _mm_set1_ps(-0.0f);
+    const __m128 tiny = _mm_set1_ps(1e-12f);
+    const __m128 toIndex = _mm_set1_ps(RAD2DEG / AeroCoeffTable::STEP_DEG);
+    const float* coeffs = f.coeffs.data();
+
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const __m128 qw = _mm_load_ps(&f.qw[i]), qx = _mm_load_ps(&f.qx[i]);
+        const __m128 qy = _mm_load_ps(&f.qy[i]), qz = _mm_load_ps(&f.qz[i]);
+        __m128 vx = _mm_load_ps(&f.vx[i]), vy = _mm_load_ps(&f.vy[i]), vz = _mm_load_ps(&f.vz[i]);
+
+        // 1) world -> body velocity (rotation by the conjugate)
+        __m128 bx = vx, by = vy, bz = vz;
+        rotate128(qw, _mm_xor_ps(qx, signMask), _mm_xor_ps(qy, signMask), _mm_xor_ps(qz, signMask), bx, by, bz);
+        __m128 V2 = _mm_max_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz)), tiny);
+        __m128 inv = rsqrt128(_mm_max_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(bx, bx), _mm_mul_ps(by, by)),
+                                                    _mm_mul_ps(bz, bz)), tiny));
+        __m128 nx = _mm_mul_ps(bx, inv), ny = _mm_mul_ps(by, inv), nz = _mm_mul_ps(bz, inv);
+
+        // 2) AoA rounded onto the quarter-degree table
+        alignas(16) int k[4];
+        _mm_store_si128((__m128i*)k, _mm_cvtps_epi32(_mm_mul_ps(atan2_128(by, bx), toIndex)));
+        const float* e[4];
+        for (int l = 0; l < 4; ++l) {
+            k[l] = std::clamp(k[l] + ZERO_AOA, 0, AeroCoeffTable::SIZE - 1);
+            e[l] = coeffs + (size_t(f.type[i + l]) * AeroCoeffTable::SIZE + size_t(k[l])) * ENTRY;
+        }
+        __m128 cl = _mm_load_ps(e[0]), cd = _mm_load_ps(e[1]), cm = _mm_load_ps(e[2]), pad = _mm_load_ps(e[3]);
+        _MM_TRANSPOSE4_PS(cl, cd, cm, pad);     // Cl, Cd, Cm, 0
+
+        // 3) lift + drag + thrust summed in body axes, one rotation to world
+        __m128 qS = _mm_mul_ps(_mm_mul_ps(halfRho, V2), _mm_load_ps(&f.wingArea[i]));
+        __m128 h = _mm_add_ps(_mm_mul_ps(nx, nx), _mm_mul_ps(ny, ny));
+        __m128 fallback = _mm_cmplt_ps(h, tiny);
+        __m128 invH = _mm_xor_ps(rsqrt128(_mm_max_ps(h, tiny)), signMask);
+        __m128 lx = selectSSE(fallback, _mm_mul_ps(_mm_mul_ps(nx, nz), invH), zero);
+        __m128 ly = selectSSE(fallback, _mm_mul_ps(_mm_mul_ps(ny, nz), invH), one);
+        __m128 lz = selectSSE(fallback, _mm_xor_ps(_mm_mul_ps(h, invH), signMask), zero);
+        __m128 L = _mm_mul_ps(qS, cl), D = _mm_mul_ps(qS, cd);
+        __m128 Fx = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(lx, L), _mm_mul_ps(nx, D)), _mm_load_ps(&f.thrust[i]));
+        __m128 Fy = _mm_sub_ps(_mm_mul_ps(ly, L), _mm_mul_ps(ny, D));
+        __m128 Fz = _mm_sub_ps(_mm_mul_ps(lz, L), _mm_mul_ps(nz, D));
+        rotate128(qw, qx, qy, qz, Fx, Fy, Fz);
+
+        // semi-implicit Euler
+        __m128 invM = _mm_div_ps(one, _mm_load_ps(&f.mass[i]));
+        vx = _mm_add_ps(vx, _mm_mul_ps(_mm_mul_ps(Fx, invM), vdt));
+        vy = _mm_add_ps(vy, _mm_mul_ps(_mm_add_ps(_mm_mul_ps(Fy, invM), g), vdt));
+        vz = _mm_add_ps(vz, _mm_mul_ps(_mm_mul_ps(Fz, invM), vdt));
+        _mm_store_ps(&f.vx[i], vx); _mm_store_ps(&f.vy[i], vy); _mm_store_ps(&f.vz[i], vz);
+        _mm_store_ps(&f.px[i], _mm_add_ps(_mm_load_ps(&f.px[i]), _mm_mul_ps(vx, vdt)));
+        _mm_store_ps(&f.py[i], _mm_add_ps(_mm_load_ps(&f.py[i]), _mm_mul_ps(vy, vdt)));
+        _mm_store_ps(&f.pz[i], _mm_add_ps(_mm_load_ps(&f.pz[i]), _mm_mul_ps(vz, vdt)));
+
+        // 4-5) pitch moment, Euler's equations
+        __m128 My = _mm_mul_ps(_mm_mul_ps(cm, qS), _mm_load_ps(&f.chord[i]));
+        __m128 wx = _mm_load_ps(&f.wx[i]), wy = _mm_load_ps(&f.wy[i]), wz = _mm_load_ps(&f.wz[i]);
+        __m128 Ix = _mm_mul_ps(_mm_load_ps(&f.Ixx[i]), wx);
+        __m128 Iy = _mm_mul_ps(_mm_load_ps(&f.Iyy[i]), wy);
+        __m128 Iz = _mm_mul_ps(_mm_load_ps(&f.Izz[i]), wz);
+        __m128 gx = _mm_sub_ps(_mm_mul_ps(wy, Iz), _mm_mul_ps(wz, Iy));
+        __m128 gy = _mm_sub_ps(_mm_mul_ps(wz, Ix), _mm_mul_ps(wx, Iz));
+        __m128 gz = _mm_sub_ps(_mm_mul_ps(wx, Iy), _mm_mul_ps(wy, Ix));
+        wx = _mm_sub_ps(wx, _mm_mul_ps(_mm_mul_ps(_mm_load_ps(&f.IxxInv[i]), gx), vdt));
+        wy = _mm_add_ps(wy, _mm_mul_ps(_mm_mul_ps(_mm_load_ps(&f.IyyInv[i]), _mm_sub_ps(My, gy)), vdt));
+        wz = _mm_sub_ps(wz, _mm_mul_ps(_mm_mul_ps(_mm_load_ps(&f.IzzInv[i]), gz), vdt));
+        _mm_store_ps(&f.wx[i], wx); _mm_store_ps(&f.wy[i], wy); _mm_store_ps(&f.wz[i], wz);
+
+        // 6) q += dt/2 q (0, w), renormalized
+        __m128 dw = _mm_add_ps(_mm_add_ps(_mm_mul_ps(qx, wx), _mm_mul_ps(qy, wy)), _mm_mul_ps(qz, wz));
+        __m128 dx = _mm_add_ps(_mm_mul_ps(qw, wx), _mm_sub_ps(_mm_mul_ps(qy, wz), _mm_mul_ps(qz, wy)));
+        __m128 dy = _mm_add_ps(_mm_mul_ps(qw, wy), _mm_sub_ps(_mm_mul_ps(qz, wx), _mm_mul_ps(qx, wz)));
+        __m128 dz = _mm_add_ps(_mm_mul_ps(qw, wz), _mm_sub_ps(_mm_mul_ps(qx, wy), _mm_mul_ps(qy, wx)));
+        __m128 nw = _mm_sub_ps(qw, _mm_mul_ps(halfDt, dw)), nqx = _mm_add_ps(qx, _mm_mul_ps(halfDt, dx));
+        __m128 nqy = _mm_add_ps(qy, _mm_mul_ps(halfDt, dy)), nqz = _mm_add_ps(qz, _mm_mul_ps(halfDt, dz));
+        __m128 qn = rsqrt128(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nw, nw), _mm_mul_ps(nqx, nqx)),
+                                        _mm_add_ps(_mm_mul_ps(nqy, nqy), _mm_mul_ps(nqz, nqz))));
+        _mm_store_ps(&f.qw[i], _mm_mul_ps(nw, qn)); _mm_store_ps(&f.qx[i], _mm_mul_ps(nqx, qn));
+        _mm_store_ps(&f.qy[i], _mm_mul_ps(nqy, qn)); _mm_store_ps(&f.qz[i], _mm_mul_ps(nqz, qn));
+
+#ifdef PHYSICS_AERO_STATS
+        recordLanes(f, i, k, unsigned(_mm_movemask_ps(fallback)), 4);
+#endif
+    }
+    return i;
+}
+#endif
+
+// ---------------------------
+// Dispatch
+// ---------------------------
+bool fleetKernelSupported(FleetKernel kernel)
+{
+    switch (kernel) {
+    case FleetKernel::Auto:
+    case FleetKernel::Scalar:
+        return true;
+    case FleetKernel::SSE:
+        return FLEET_SIMD_X86;
+#if FLEET_SIMD_AVX2
+    case FleetKernel::AVX2:
+        return cpuHasAVX2();
+#endif
+#if FLEET_SIMD_AVX512
+    case FleetKernel::AVX512:
+        return cpuHasAVX512();
+#endif
+    default:
+        return false;
+    }
+}
+
+FleetKernel fleetBestKernel()
+{
+    for (FleetKernel k : {FleetKernel::AVX512, FleetKernel::AVX2, FleetKernel::SSE})
+        if (fleetKernelSupported(k)) return k;
+    return FleetKernel::Scalar;
+}
+
+const char* fleetKernelName(FleetKernel kernel)
+{
+    switch (kernel) {
+    case FleetKernel::Scalar: return "scalar";
+    case FleetKernel::SSE:    return "SSE";
+    case FleetKernel::AVX2:   return "AVX2";
+    case FleetKernel::AVX512: return "AVX-512";
+    default:                  return "auto";
+    }
+}
+
+static FleetKernel resolveKernel(FleetKernel kernel)
+{
+    return (kernel == FleetKernel::Auto || !fleetKernelSupported(kernel)) ? fleetBestKernel() : kernel;
+}
+
+// aircraft [begin, end) with one kernel, scalar for what is left of the range
+static void stepRange(AircraftFleet& f, size_t begin, size_t end, float dt, FleetKernel kernel)
+{
+    size_t done = begin;
+    switch (kernel) {
+#if FLEET_SIMD_AVX512
+    case FleetKernel::AVX512: done = stepAVX512(f, begin, end, dt); break;
+#endif
+#if FLEET_SIMD_AVX2
+    case FleetKernel::AVX2:   done = stepAVX2(f, begin, end, dt); break;
+#endif
+#if FLEET_SIMD_X86
+    case FleetKernel::SSE:    done = stepSSE(f, begin, end, dt); break;
+#endif
+    default: break;
+    }
+    stepScalar(f, done, end, dt);
+}
+
+void updatePhysicsBatch(AircraftFleet& f, float dt, FleetKernel kernel)
+{
+    if (dt <= 0.0f) return;
+    stepRange(f, 0, f.size(), dt, resolveKernel(kernel));
+}
+
+void updatePhysicsBatch(ThreadPool& pool, AircraftFleet& f, float dt, FleetKernel kernel, size_t chunk)
+{
+    if (dt <= 0.0f) return;
+    kernel = resolveKernel(kernel);
+    chunk = (std::max<size_t>(chunk, 1) + 15) & ~size_t(15);
+    pool.parallelFor(f.size(), chunk, [&](size_t begin, size_t end, unsigned) {
+        stepRange(f, begin, end, dt, kernel);
+    });
+}
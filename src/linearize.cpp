@@ -0,0 +1,314 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "linearize.h"
+#include "threadpool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+static constexpr int NX = AIRCRAFT_STATE_SIZE;
+static constexpr int NU = AIRCRAFT_INPUT_SIZE;
+
+// aircraft per propagation tile: x, the next x and the held-input term,
+// 3 x 13 x 128 floats, stay in L1 for every step of a call
+static constexpr size_t TILE = 128;
+
+// ---------------------------
+// State <-> the 13 coordinates of aircraftJacobian
+// ---------------------------
+static void packState(const RigidState& s, float* x)
+{
+    const float v[NX] = {
+        s.position.x, s.position.y, s.position.z, s.velocity.x, s.velocity.y, s.velocity.z,
+        s.orientation.w, s.orientation.x, s.orientation.y, s.orientation.z,
+        s.angularVelocity.x, s.angularVelocity.y, s.angularVelocity.z,
+    };
+    std::copy(v, v + NX, x);
+}
+
+static RigidState unpackState(const float* x)
+{
+    RigidState s;
+    s.position = glm::vec3(x[0], x[1], x[2]);
+    s.velocity = glm::vec3(x[3], x[4], x[5]);
+    s.orientation = glm::quat(x[6], x[7], x[8], x[9]);
+    s.angularVelocity = glm::vec3(x[10], x[11], x[12]);
+    return s;
+}
+
+static void packDerivative(const RigidDerivative& d, float* f)
+{
+    const float v[NX] = {
+        d.dPosition.x, d.dPosition.y, d.dPosition.z, d.dVelocity.x, d.dVelocity.y, d.dVelocity.z,
+        d.dOrientation.w, d.dOrientation.x, d.dOrientation.y, d.dOrientation.z,
+        d.dAngularVelocity.x, d.dAngularVelocity.y, d.dAngularVelocity.z,
+    };
+    std::copy(v, v + NX, f);
+}
+
+static void packInputs(float thrust, const glm::vec3& controls, float* u)
+{
+    u[0] = thrust;
+    u[1] = controls.x;
+    u[2] = controls.y;
+    u[3] = controls.z;
+}
+
+// ---------------------------
+// Linearization
+// ---------------------------
+void linearizeAircraft(Aircraft& plane, LinearModel& out)
+{
+    out.state = aircraftState(plane);
+    out.thrust = plane.thrust;
+    out.controls = plane.controls;
+    out.exact = dualDerivatives(plane);
+    if (out.exact) {
+        aircraftJacobian(plane, out.state, out.jacobian);
+        return;
+    }
+
+    // strips / lattice: central differences, steps relative to the coordinate
+    AircraftJacobian& J = out.jacobian;
+    J.f = aircraftDerivative(plane, out.state, false, false);
+    float x0[NX], u0[NU], fp[NX], fm[NX];
+    packState(out.state, x0);
+    packInputs(plane.thrust, plane.controls, u0);
+    Aircraft probe = plane;
+    for (int j = 0; j < NX + NU; ++j) {
+        const float base = j < NX ? x0[j] : u0[j - NX];
+        const float h = 1e-3f * std::max(1.0f, std::fabs(base));
+        for (int side = 0; side < 2; ++side) {
+            float x[NX], u[NU];
+            std::copy(x0, x0 + NX, x);
+            std::copy(u0, u0 + NU, u);
+            (j < NX ? x[j] : u[j - NX]) = base + (side ? -h : h);
+            probe.thrust = u[0];
+            probe.controls = glm::vec3(u[1], u[2], u[3]);
+            packDerivative(aircraftDerivative(probe, unpackState(x), false, false), side ? fm : fp);
+        }
+        for (int i = 0; i < NX; ++i) {
+            const float slope = (fp[i] - fm[i]) / (2.0f * h);
+            if (j < NX) J.A[i][j] = slope;
+            else J.B[i][j - NX] = slope;
+        }
+    }
+}
+
+// ---------------------------
+// Discretization: exp(M dt) for M = [A B f0; 0 0 0], by scaling and
+// squaring a Taylor series (in double; M is small)
+// ---------------------------
+static constexpr int NM = NX + NU + 1;
+using Mat = double[NM][NM];
+
+static void multiply(const Mat a, const Mat b, Mat out)
+{
+    for (int i = 0; i < NM; ++i)
+        for (int j = 0; j < NM; ++j) {
+            double s = 0.0;
+            for (int k = 0; k < NM; ++k) s += a[i][k] * b[k][j];
+            out[i][j] = s;
+        }
+}
+
+bool discretizeLinearModel(const LinearModel& model, float dt, DiscreteLinearModel& out)
+{
+    if (!(dt > 0.0f)) {
+        std::cerr << "discretizeLinearModel: dt must be positive\n";
+        return false;
+    }
+    const AircraftJacobian& J = model.jacobian;
+    float f0[NX];
+    packDerivative(J.f, f0);
+
+    Mat M = {};
+    double norm = 0.0;     // 1-norm: largest column sum
+    for (int j = 0; j < NM; ++j) {
+        double col = 0.0;
+        for (int i = 0; i < NX; ++i) {
+            M[i][j] = dt * double(j < NX ? J.A[i][j] : j < NX + NU ? J.B[i][j - NX] : f0[i]);
+            col += std::fabs(M[i][j]);
+        }
+        norm = std::max(norm, col);
+    }
+    if (!std::isfinite(norm)) {
+        std::cerr << "discretizeLinearModel: the linear model is not finite\n";
+        return false;
+    }
+
+    // scale to ||M|| <= 1/2, where 20 terms are far below double precision
+    int squarings = 0;
+    while (norm > 0.5 && squarings < 64) {
+        norm *= 0.5;
+        ++squarings;
+    }
+    const double scale = std::ldexp(1.0, -squarings);
+    for (auto& row : M)
+        for (double& m : row) m *= scale;
+
+    Mat E = {}, term = {}, next;
+    for (int i = 0; i < NM; ++i) E[i][i] = term[i][i] = 1.0;
+    for (int k = 1; k <= 20; ++k) {
+        multiply(term, M, next);
+        for (int i = 0; i < NM; ++i)
+            for (int j = 0; j < NM; ++j) {
+                term[i][j] = next[i][j] / k;
+                E[i][j] += term[i][j];
+            }
+    }
+    for (int s = 0; s < squarings; ++s) {
+        multiply(E, E, next);
+        std::memcpy(E, next, sizeof(Mat));
+    }
+
+    out.dt = dt;
+    for (int i = 0; i < NX; ++i) {
+        for (int j = 0; j < NX; ++j) out.Phi[i][j] = float(E[i][j]);
+        for (int j = 0; j < NU; ++j) out.Gamma[i][j] = float(E[i][NX + j]);
+        out.c[i] = float(E[i][NX + NU]);
+    }
+    return true;
+}
+
+// ---------------------------
+// LtiFleet
+// ---------------------------
+bool LtiFleet::init(const LinearModel& m, float dt, const LtiLimits& l)
+{
+    if (!discretizeLinearModel(m, dt, discrete)) return false;
+    model = m;
+    limits = l;
+    for (auto& col : dx) col.clear();
+    for (auto& col : du) col.clear();
+    drifted.clear();
+    stepsTaken.clear();
+    return true;
+}
+
+void LtiFleet::reserve(size_t n)
+{
+    for (auto& col : dx) col.reserve(n);
+    for (auto& col : du) col.reserve(n);
+    drifted.reserve(n);
+    stepsTaken.reserve(n);
+}
+
+size_t LtiFleet::add(const Aircraft& plane)
+{
+    float x[NX], x0[NX], u[NU], u0[NU];
+    packState(aircraftState(plane), x);
+    packState(model.state, x0);
+    packInputs(plane.thrust, plane.controls, u);
+    packInputs(model.thrust, model.controls, u0);
+    for (int i = 0; i < NX; ++i) dx[i].push_back(x[i] - x0[i]);
+    for (int i = 0; i < NU; ++i) du[i].push_back(u[i] - u0[i]);
+    drifted.push_back(0);
+    stepsTaken.push_back(0);
+    return size() - 1;
+}
+
+void LtiFleet::read(size_t i, Aircraft& plane) const
+{
+    float x[NX], u[NU];
+    packState(model.state, x);
+    packInputs(model.thrust, model.controls, u);
+    for (int k = 0; k < NX; ++k) x[k] += dx[k][i];
+    for (int k = 0; k < NU; ++k) u[k] += du[k][i];
+    RigidState s = unpackState(x);
+    s.orientation = glm::normalize(s.orientation);
+    setAircraftState(plane, s);
+    plane.thrust = u[0];
+    plane.controls = glm::vec3(u[1], u[2], u[3]);
+}
+
+// ---------------------------
+// Propagation, one tile at a time: load, run every step, store. Rows are
+// broadcast multiply-adds over the tile's full width (padding lanes count
+// as drifted), so the loops have fixed trip counts and vectorize.
+// ---------------------------
+static size_t propagateRange(LtiFleet& f, size_t begin, size_t end, int steps)
+{
+    const DiscreteLinearModel& D = f.discrete;
+    const float speed2 = f.limits.speed * f.limits.speed;
+    const float attitude2 = 0.25f * f.limits.attitude * f.limits.attitude;    // on |dq| = angle / 2
+    const float rate2 = f.limits.rate * f.limits.rate;
+
+    alignas(64) float x[NX][TILE], y[NX][TILE], g[NX][TILE];
+    alignas(64) float advance[TILE];
+    size_t newly = 0;
+
+    for (size_t t0 = begin; t0 < end; t0 += TILE) {
+        const size_t n = std::min(TILE, end - t0);
+        size_t live = 0;
+        for (size_t k = 0; k < TILE; ++k) {
+            const bool in = k < n && !f.drifted[t0 + k];
+            advance[k] = in ? 1.0f : 0.0f;
+            live += in;
+        }
+        if (live == 0) continue;
+
+        for (int i = 0; i < NX; ++i) {
+            std::fill(x[i], x[i] + TILE, 0.0f);
+            std::copy(f.dx[i].data() + t0, f.dx[i].data() + t0 + n, x[i]);
+        }
+        // held inputs: Gamma du + c is the same every step
+        for (int i = 0; i < NX; ++i) {
+            for (size_t k = 0; k < TILE; ++k) g[i][k] = D.c[i];
+            for (int m = 0; m < NU; ++m) {
+                const float gm = D.Gamma[i][m];
+                const float* u = f.du[m].data() + t0;
+                for (size_t k = 0; k < n; ++k) g[i][k] += gm * u[k];
+            }
+        }
+
+        uint32_t taken[TILE] = {};
+        for (int s = 0; s < steps && live > 0; ++s) {
+            for (int i = 0; i < NX; ++i) {
+                float* yi = y[i];
+                std::copy(g[i], g[i] + TILE, yi);
+                for (int j = 0; j < NX; ++j) {
+                    const float p = D.Phi[i][j];
+                    const float* xj = x[j];
+                    for (size_t k = 0; k < TILE; ++k) yi[k] += p * xj[k];
+                }
+            }
+
+            // a step that would leave the limits is not taken (NaN fails too)
+            for (size_t k = 0; k < TILE; ++k) {
+                const float dv = y[3][k] * y[3][k] + y[4][k] * y[4][k] + y[5][k] * y[5][k];
+                const float dq = y[6][k] * y[6][k] + y[7][k] * y[7][k] + y[8][k] * y[8][k] + y[9][k] * y[9][k];
+                const float dw = y[10][k] * y[10][k] + y[11][k] * y[11][k] + y[12][k] * y[12][k];
+                const bool inside = dv <= speed2 && dq <= attitude2 && dw <= rate2;
+                if (advance[k] != 0.0f && !inside) {
+                    advance[k] = 0.0f;
+                    f.drifted[t0 + k] = 1;
+                    ++newly;
+                    --live;
+                }
+                taken[k] += advance[k] != 0.0f;
+            }
+            for (int i = 0; i < NX; ++i)
+                for (size_t k = 0; k < TILE; ++k) x[i][k] = advance[k] != 0.0f ? y[i][k] : x[i][k];
+        }
+
+        for (int i = 0; i < NX; ++i) std::copy(x[i], x[i] + n, f.dx[i].data() + t0);
+        for (size_t k = 0; k < n; ++k) f.stepsTaken[t0 + k] += taken[k];
+    }
+    return newly;
+}
+
+size_t propagateLti(LtiFleet& fleet, int steps)
+{
+    if (steps <= 0) return 0;
+    return propagateRange(fleet, 0, fleet.size(), steps);
+}
+
+size_t propagateLti(ThreadPool& pool, LtiFleet& fleet, int steps, size_t chunk)
+{
+    if (steps <= 0) return 0;
+    chunk = (std::max<size_t>(chunk, 1) + 15) & ~size_t(15);
+    return pool.parallelReduce(fleet.size(), chunk, size_t(0),
+                               [&](size_t begin, size_t end) { return propagateRange(fleet, begin, end, steps); },
+                               [](size_t a, size_t b) { return a + b; });
+}
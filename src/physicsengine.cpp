@@ -1,7 +1,17 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include "physicsengine.h"
+#include "aerostats.h"
+#include "threadpool.h"
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <type_traits>
+#include <utility>
 #include <glm/gtx/quaternion.hpp>
 
 static constexpr float PI_F = 3.14159265358979323846f;
@@ -11,71 +21,54 @@ static constexpr float DEG2RAD = PI_F / 180.0f;
 // ---------------------------
 // Airfoil Implementation
 // ---------------------------
-Airfoil::Airfoil(const std::vector<glm::vec4>& curve)
-    : data(curve)
+Airfoil::Airfoil(const std::vector<glm::vec4>& curve, PolarInterpolation mode)
+    : polar(acquirePolar(curve, mode))
 {
-    if (!data.empty()) {
-        min_alpha = data.front().x;
-        max_alpha = data.back().x;
-    } else {
-        min_alpha = 0.0f;
-        max_alpha = 0.0f;
-    }
 }
 
-AeroCoeffs Airfoil::sample(float alpha_deg) const
+Airfoil::Airfoil(std::shared_ptr<const PolarData> polar_)
+    : polar(internPolar(std::move(polar_)))
 {
-    if (data.empty()) return {0,0,0,0,0};
-
-    alpha_deg = std::clamp(alpha_deg, min_alpha, max_alpha);
+}
 
-    for (size_t i = 0; i + 1 < data.size(); ++i) {
-        if (alpha_deg >= data[i].x && alpha_deg <= data[i+1].x) {
-            float t = (alpha_deg - data[i].x) / (data[i+1].x - data[i].x);
-            AeroCoeffs c;
-            c.Cl      = data[i].y + t * (data[i+1].y - data[i].y);
-            c.Cd      = data[i].z + t * (data[i+1].z - data[i].z);
-            c.Cm      = data[i].w + t * (data[i+1].w - data[i].w);
-            c.Cl_roll = 0.0f;
-            c.Cn_yaw  = 0.0f;
-            return c;
-        }
-    }
-    return {0,0,0,0,0};
+Airfoil::Airfoil(std::shared_ptr<const PolarData> polar_, std::shared_ptr<const PolarGrid> grid_)
+    : polar(internPolar(std::move(polar_))), grid(std::move(grid_))
+{
 }
 
-float Airfoil::estimateClAlpha2D() const
+AeroCoeffs Airfoil::sample(float alpha_deg, float reynolds, float mach, PolarCellHint* hint) const
 {
-    // Numerically estimate dCl/dalpha (per rad) around alpha ~= 0 using nearby samples.
-    if (data.size() < 3) return 2.0f * PI_F;
+    if (!grid) return sample(alpha_deg);
+    return grid->sample(alpha_deg, reynolds, mach, hint);
+}
 
-    // find index bracketing 0 deg
-    size_t idx = 0;
-    for (size_t i = 0; i + 1 < data.size(); ++i) {
-        if (data[i].x <= 0.0f && data[i+1].x >= 0.0f) { idx = i; break; }
+AeroCoeffs Airfoil::sample(float alpha_deg) const
+{
+    const PolarData& p = *polar;
+    if (p.segmentCount == 0) return {0,0,0,0,0};
+
+    alpha_deg = std::clamp(alpha_deg, p.min_alpha, p.max_alpha);
+    const size_t i = p.segmentIndex(alpha_deg);
+    AERO_STAT(++stats.polarSamples;
+              ++stats.segmentIndex[std::min(i, size_t(AeroStats::SEGMENT_BINS - 1))]);
+
+    if (p.cubic) {
+        // Horner over packed (Cl, Cd, Cm) coefficients
+        const glm::vec4* c = p.cubic[i].c;
+        float d = alpha_deg - c[0].w;
+        glm::vec4 r = ((c[3] * d + c[2]) * d + c[1]) * d + c[0];
+        return { r.x, r.y, r.z, 0.0f, 0.0f };
     }
 
-    // take small window of samples up to +/- 2 entries
-    float sumNum = 0.0f, sumDen = 0.0f;
-    int nSamples = 0;
-    for (int k = -2; k <= 2; ++k) {
-        int p1 = int(idx) + k;
-        int p2 = p1 + 1;
-        if (p1 >= 0 && p2 < (int)data.size()) {
-            float a1 = data[p1].x * DEG2RAD;
-            float a2 = data[p2].x * DEG2RAD;
-            float c1 = data[p1].y;
-            float c2 = data[p2].y;
-            float da = (a2 - a1);
-            if (std::fabs(da) > 1e-6f) {
-                sumNum += (c2 - c1);
-                sumDen += da;
-                ++nSamples;
-            }
-        }
-    }
-    if (nSamples == 0 || std::fabs(sumDen) < 1e-9f) return 2.0f * PI_F;
-    return sumNum / sumDen; // dCl/dα (per rad)
+    const PolarSegment& s = p.segments[i];
+    float d = alpha_deg - s.alpha;
+    AeroCoeffs c;
+    c.Cl      = s.Cl + s.dCl * d;
+    c.Cd      = s.Cd + s.dCd * d;
+    c.Cm      = s.Cm + s.dCm * d;
+    c.Cl_roll = 0.0f;
+    c.Cn_yaw  = 0.0f;
+    return c;
 }
 
 // ---------------------------
@@ -86,8 +79,9 @@ Aircraft::Aircraft(const Airfoil& foil)
       position(0.0f), velocity(0.0f), acceleration(0.0f),
       orientation(1.0f, 0.0f, 0.0f, 0.0f), // identity quat
       angularVelocity(0.0f), angularAcceleration(0.0f),
+      orientationUpdate(OrientationUpdate::Linear),
       mass(1.0f), wingArea(1.0f), wingspan(1.0f), chord(0.1f),
-      thrust(0.0f), inertia(1.0f), inertiaInv(1.0f),
+      thrust(0.0f), controls(0.0f), inertia(1.0f), inertiaInv(1.0f),
       lift(0.0f), drag(0.0f), thrustVec(0.0f), totalForce(0.0f),
       bodyMoment(0.0f)
 {
@@ -100,15 +94,14 @@ float roundToQuarter(float x) {
     return std::round(x / 0.25f) * 0.25f;
 }
 
-float estimateCm(float alpha_deg) {
-    if (alpha_deg < 0.0f) return -0.05f;
-    if (alpha_deg > 15.0f) return -0.09f;
-    return -0.05f - 0.04f * (alpha_deg / 15.0f);
-}
-
 // ---------------------------
 // Aerodynamics Helpers
 // ---------------------------
+float aspectRatio(const Aircraft& plane)
+{
+    return (plane.wingArea > 1e-6f) ? (plane.wingspan * plane.wingspan / plane.wingArea) : 1.0f;
+}
+
 float liftCurveSlopeFinite(float Cl_alpha_2D_per_rad, float AR)
 {
     // Use lifting-line style correction: a = a0 / (1 + a0/(pi*AR))
@@ -116,200 +109,647 @@ float liftCurveSlopeFinite(float Cl_alpha_2D_per_rad, float AR)
     return Cl_alpha_2D_per_rad / (1.0f + Cl_alpha_2D_per_rad / (PI_F * AR));
 }
 
-float inducedAngleFromCL(float CL, float AR)
+template <class S>
+static S inducedAngle(const S& CL, float AR)
 {
-    if (AR <= 0.0f) return 0.0f;
+    if (AR <= 0.0f) return S(0.0f);
     return CL / (PI_F * AR);
 }
 
+float inducedAngleFromCL(float CL, float AR)
+{
+    return inducedAngle(CL, AR);
+}
+
 // compute aerodynamic coefficients using the paper's approach (simplified single-surface model)
 // - alpha_deg: geometric AoA (deg) positive nose-up
 // - AR: aspect ratio
-// - Cd0: baseline friction drag
-AeroCoeffs computeAeroCoeffsPaper(float alpha_deg, float AR, float Cd0)
+// - props: airfoil section data (slope, zero-lift angle, stall angle, Cd0)
+template <class S>
+PaperCoeffs<S> paperCoeffs(S alpha_deg, float AR, const AirfoilProperties& props)
 {
+    using std::cos;
+    using std::fabs;
+    using std::sin;
+
     // ----- parameters / safety -----
-    const float stall_deg = 15.0f;   // nominal stall angle (±)
+    const float stall_deg = props.stallDeg;   // stall angle (±), from the polar
     const float CL_limit = 3.0f;     // hard clamp on CL to prevent explosion
-    const float alpha_deg_abs = std::fabs(alpha_deg);
+    const S alpha_deg_abs = fabs(alpha_deg);
 
     // low-angle linear region
     if (alpha_deg_abs <= stall_deg) {
-        // approximate 2D slope ~ 2π per rad (or estimate from airfoil if available)
-        float a0 = 2.0f * PI_F; // per rad; for a better result pass in airfoil data externally
+        AERO_STAT(++stats.paperLinear);
+        // 2D section slope from the polar, corrected for finite span
+        float a0 = props.clAlpha; // per rad
         float a = liftCurveSlopeFinite(a0, AR); // per rad
 
-        float alpha_rad = alpha_deg * DEG2RAD;
-        // zero-lift offset assumed zero for simplicity (or user table can define it)
-        float alpha0_rad = 0.0f;
+        S alpha_rad = alpha_deg * DEG2RAD;
+        // zero-lift offset of the section (cambered airfoils lift at 0 deg)
+        float alpha0_rad = props.zeroLiftDeg * DEG2RAD;
 
-        float CL = a * (alpha_rad - alpha0_rad);
+        S CL = a * (alpha_rad - alpha0_rad);
         // induced angle (rad)
-        float alpha_i = inducedAngleFromCL(CL, AR);
-        float alpha_eff = alpha_rad - alpha_i;
+        S alpha_i = inducedAngle(CL, AR);
+        S alpha_eff = alpha_rad - alpha_i;
 
         // approximate normal/tangential (2D) decomposition
-        float CN = CL / std::cos(alpha_eff);
-        float CT = Cd0; // baseline tangential (skin friction)
+        S CN = CL / cos(alpha_eff);
+        float CT = props.cd0; // baseline tangential (skin friction)
 
-        float CD = CN * std::sin(alpha_eff) + CT * std::cos(alpha_eff);
-        float CM = 0.25f * CN; // simple representation
+        S CD = CN * sin(alpha_eff) + CT * cos(alpha_eff);
+        S CM = 0.25f * CN; // simple representation
 
         // bound CL and CD
-        CL = std::clamp(CL, -CL_limit, CL_limit);
-        CD = std::max(CD, 0.0001f);
+        CL = std::clamp(CL, S(-CL_limit), S(CL_limit));
+        CD = std::max(CD, S(0.0001f));
 
-        return { CL, CD, CM, 0.0f, 0.0f };
+        return { CL, CD, CM };
     }
 
     // ----- post-stall (flat-plate style) -----
     {
+        AERO_STAT(++stats.paperPostStall);
         // convert to rad
-        float alpha_rad = alpha_deg * DEG2RAD;
+        S alpha_rad = alpha_deg * DEG2RAD;
         // approximate induced angle taper from stall -> 90deg (linear taper)
         float sign = (alpha_deg >= 0.0f) ? 1.0f : -1.0f;
         float stall_rad = stall_deg * DEG2RAD;
 
         // approximate CL using flat-plate model:
         // CN ≈ 2 * sin(alpha)*cos(alpha) = sin(2α)
-        float CN = std::sin(2.0f * alpha_rad);
-        float CT = 0.5f * std::cos(alpha_rad);
+        S CN = sin(2.0f * alpha_rad);
+        S CT = 0.5f * cos(alpha_rad);
 
-        float CD = std::fabs(CN * std::sin(alpha_rad)) + std::fabs(CT * std::cos(alpha_rad));
-        float CL = CN * std::cos(alpha_rad) - CT * std::sin(alpha_rad);
+        S CD = fabs(CN * sin(alpha_rad)) + fabs(CT * cos(alpha_rad));
+        S CL = CN * cos(alpha_rad) - CT * sin(alpha_rad);
 
         // blend toward Cd90 near 90 deg - use baseline 1.98 (paper)
         float Cd90 = 1.98f;
-        float fracNear90 = std::min(1.0f, std::fabs(alpha_deg) / 90.0f);
-        CD = glm::mix(CD, Cd90, fracNear90 * 0.5f);
+        S fracNear90 = std::min(S(1.0f), fabs(alpha_deg) / 90.0f);
+        S blend = fracNear90 * 0.5f;
+        CD = CD * (1.0f - blend) + Cd90 * blend;    // glm::mix(CD, Cd90, blend)
 
         // limit CL magnitude to prevent runaway
-        CL = std::clamp(CL, -CL_limit, CL_limit);
-        CD = std::max(CD, 0.01f);
+        CL = std::clamp(CL, S(-CL_limit), S(CL_limit));
+        CD = std::max(CD, S(0.01f));
 
-        float CM = 0.25f * CN;
+        S CM = 0.25f * CN;
 
-        return { CL, CD, CM, 0.0f, 0.0f };
+        return { CL, CD, CM };
     }
 }
 
+// add a line here for other scalars
+template PaperCoeffs<float> paperCoeffs(float, float, const AirfoilProperties&);
+template PaperCoeffs<Dual<6>> paperCoeffs(Dual<6>, float, const AirfoilProperties&);
+template PaperCoeffs<AircraftDual> paperCoeffs(AircraftDual, float, const AirfoilProperties&);
+
+AeroCoeffs computeAeroCoeffsPaper(float alpha_deg, float AR, const AirfoilProperties& props)
+{
+    PaperCoeffs<float> c = paperCoeffs(alpha_deg, AR, props);
+    return { c.Cl, c.Cd, c.Cm, 0.0f, 0.0f };
+}
+
+AeroCoeffs computeAeroCoeffsPaper(float alpha_deg, float AR, float Cd0)
+{
+    return computeAeroCoeffsPaper(alpha_deg, AR, paperDefaultProperties(Cd0));
+}
+
 // ---------------------------
-// Physics Update (REAL 3D orientation + stable aero)
+// Aero Coefficient Table
 // ---------------------------
-void updatePhysics(Aircraft& plane, float /*aoa_unused*/, float /*sideslip_unused*/, float dt)
+AeroCoeffTable::AeroCoeffTable(float AR_, const AirfoilProperties& props_)
+    : AR(AR_), props(props_), entries(SIZE)
 {
-    // early out
-    if (dt <= 0.0f) return;
+    for (int i = 0; i < SIZE; ++i)
+        entries[i] = computeAeroCoeffsPaper(MIN_DEG + float(i) * STEP_DEG, AR, props);
+}
 
-    const float rho = 1.225f;
+const AeroCoeffs& AeroCoeffTable::lookup(float aoa_deg) const
+{
+    int i = std::clamp(int(std::lround((aoa_deg - MIN_DEG) * (1.0f / STEP_DEG))), 0, SIZE - 1);
+    AERO_STAT(++stats.tableIndex[i]);
+    return entries[i];
+}
+
+AeroCoeffs AeroCoeffTable::lookupLinear(float aoa_deg) const
+{
+    float u = std::clamp((aoa_deg - MIN_DEG) * (1.0f / STEP_DEG), 0.0f, float(SIZE - 1));
+    int i = std::min(int(u), SIZE - 2);
+    float t = u - float(i);
+    AERO_STAT(++stats.tableIndex[t < 0.5f ? i : i + 1]);
+    const AeroCoeffs& a = entries[i];
+    const AeroCoeffs& b = entries[i + 1];
+    return {a.Cl + t * (b.Cl - a.Cl), a.Cd + t * (b.Cd - a.Cd), a.Cm + t * (b.Cm - a.Cm),
+            a.Cl_roll + t * (b.Cl_roll - a.Cl_roll), a.Cn_yaw + t * (b.Cn_yaw - a.Cn_yaw)};
+}
+
+// tables are built rarely (aircraft creation / geometry / airfoil edits), so
+// a mutex-guarded map is fine; updatePhysics only touches the shared_ptr
+using AeroTableKey = std::array<float, 6>;
+static std::mutex aeroTableMutex;
+static std::map<AeroTableKey, std::weak_ptr<const AeroCoeffTable>> aeroTableCache;
+
+// caller holds aeroTableMutex
+static void pruneAeroTables()
+{
+    for (auto it = aeroTableCache.begin(); it != aeroTableCache.end();)
+        it = it->second.expired() ? aeroTableCache.erase(it) : std::next(it);
+}
+
+std::shared_ptr<const AeroCoeffTable> acquireAeroCoeffTable(float AR, const AirfoilProperties& props)
+{
+    std::lock_guard<std::mutex> lock(aeroTableMutex);
+    const AeroTableKey key{AR, props.clAlpha, props.zeroLiftDeg, props.stallDeg, props.clMax, props.cd0};
+    auto it = aeroTableCache.find(key);
+    if (it != aeroTableCache.end())
+        if (auto table = it->second.lock()) return table;
+
+    // a miss builds SIZE entries, so dropping expired slots here costs little
+    // and keeps the map at the live tables plus at most this one
+    pruneAeroTables();
+    auto table = std::make_shared<const AeroCoeffTable>(AR, props);
+    aeroTableCache[key] = table;
+    return table;
+}
+
+size_t liveAeroCoeffTableCount()
+{
+    std::lock_guard<std::mutex> lock(aeroTableMutex);
+    pruneAeroTables();
+    return aeroTableCache.size();
+}
+
+// Steps 3-4 tail: total force and body moment -> state derivative
+// (rigid-body equations, diagonal inertia)
+template <PhysicsFeatures F, class S>
+static RigidDerivativeOf<S> rigidDerivative(Aircraft& plane, const RigidStateOf<S>& s, const glm::vec<3, S>& totalForce,
+                                            const glm::vec<3, S>& bodyMoment, bool record)
+{
+    using V3 = glm::vec<3, S>;
+    RigidDerivativeOf<S> d;
+    if constexpr (F.rotation) {
+        // --- 5) Rotational dynamics: full rigid-body (body frame)
+        // inertia is diagonal (Ixx,Iyy,Izz) stored in plane.inertia, inverse in inertiaInv
+        glm::vec3 I = plane.inertia;
+        glm::vec3 Iinv = plane.inertiaInv;
+
+        // omega x (I * omega)
+        V3 omegaCrossIomega(0.0f);
+        if constexpr (F.gyroscopic) {
+            V3 Iomega = V3(I.x * s.angularVelocity.x,
+                           I.y * s.angularVelocity.y,
+                           I.z * s.angularVelocity.z);
+            omegaCrossIomega = glm::cross(s.angularVelocity, Iomega);
+        }
+
+        // Euler rotational equation: I * domega = M - omega x (I*omega)
+        d.dAngularVelocity.x = Iinv.x * (bodyMoment.x - omegaCrossIomega.x);
+        d.dAngularVelocity.y = Iinv.y * (bodyMoment.y - omegaCrossIomega.y);
+        d.dAngularVelocity.z = Iinv.z * (bodyMoment.z - omegaCrossIomega.z);
+
+        // --- 6) Quaternion kinematics: q_dot = 0.5 * q * omega_quat  (omega_quat = (0, ω_body))
+        d.dOrientation = orientationRate(s.orientation, s.angularVelocity);
+    }
+
+    d.dPosition = s.velocity;
+    d.dVelocity = totalForce / S(plane.mass);
+
+    if constexpr (std::is_same_v<S, float>) {
+        if (F.diagnostics && record) {
+            plane.totalForce = totalForce;
+            plane.acceleration = d.dVelocity;
+            plane.bodyMoment = bodyMoment;
+            plane.angularAcceleration = d.dAngularVelocity;
+        }
+    }
+    return d;
+}
+
+// Distributed models: body-axis force/moment about the CG -> world force
+static glm::vec3 bodyLoadsForce(Aircraft& plane, const RigidState& s, float V, float thrust, const StripLoads& loads,
+                                bool record)
+{
     const glm::vec3 gravity_world(0.0f, -9.81f, 0.0f);
+    const glm::quat& q = s.orientation;
+    glm::vec3 aero_world = glm::vec3(q * glm::vec4(loads.force, 0.0f));
+    glm::vec3 thrust_world = glm::vec3(q * glm::vec4(thrust, 0.0f, 0.0f, 0.0f));
+
+    if (record) {
+        // split the resultant into drag (along velocity) and lift for consumers
+        glm::vec3 v_dir = s.velocity / V;
+        plane.drag = v_dir * glm::dot(aero_world, v_dir);
+        plane.lift = aero_world - plane.drag;
+        plane.thrustVec = thrust_world;
+    }
+    return aero_world + thrust_world + gravity_world * plane.mass;
+}
+
+RigidState aircraftState(const Aircraft& plane)
+{
+    return {plane.position, plane.velocity, plane.orientation, plane.angularVelocity};
+}
+
+void setAircraftState(Aircraft& plane, const RigidState& s)
+{
+    plane.position = s.position;
+    plane.velocity = s.velocity;
+    plane.orientation = s.orientation;
+    plane.angularVelocity = s.angularVelocity;
+}
+
+// Lumped table sampled linearly in a dual AoA: the partials are the slope
+// of the segment (what lookupLinear interpolates along)
+template <int N>
+static void lookupLinear(const AeroCoeffTable& table, const Dual<N>& aoa_deg, Dual<N>& Cl, Dual<N>& Cd, Dual<N>& Cm)
+{
+    using T = AeroCoeffTable;
+    Dual<N> u = (aoa_deg - T::MIN_DEG) * (1.0f / T::STEP_DEG);
+    if (u.v < 0.0f || u.v > float(T::SIZE - 1)) u = std::clamp(u.v, 0.0f, float(T::SIZE - 1));
+    int i = std::min(int(u.v), T::SIZE - 2);
+    Dual<N> t = u - float(i);
+    const AeroCoeffs& a = table.entries[i];
+    const AeroCoeffs& b = table.entries[i + 1];
+    Cl = a.Cl + t * (b.Cl - a.Cl);
+    Cd = a.Cd + t * (b.Cd - a.Cd);
+    Cm = a.Cm + t * (b.Cm - a.Cm);
+}
+
+// a stability-table field as a scalar: float as sampled, or a dual with the
+// table's alpha/beta slopes chained onto the AoA and sideslip partials
+template <class S>
+static S stabilityField(float v, float dAlpha, float dBeta, const S& alpha_deg, const S& beta_deg)
+{
+    if constexpr (std::is_same_v<S, float>) {
+        return v;
+    } else {
+        S r(v);
+        for (size_t i = 0; i < std::size(r.d); ++i) r.d[i] = dAlpha * alpha_deg.d[i] + dBeta * beta_deg.d[i];
+        return r;
+    }
+}
+
+// ---------------------------
+// Derivative evaluation (REAL 3D orientation + stable aero)
+//
+// Templated on the scalar: float is the simulation path; a Dual<N> carries
+// partials through the lumped model (AoA always interpolated, since
+// quarter-degree rounding has zero slope) and the stability table. The
+// strip and lattice kernels are float-only: a dual evaluation of those
+// models returns NaN.
+// ---------------------------
+template <PhysicsFeatures F, class S>
+static RigidDerivativeOf<S> evaluateDerivative(Aircraft& plane, const RigidStateOf<S>& s, const S& thrust,
+                                               const glm::vec<3, S>& controls, bool record, bool quantizeAoA)
+{
+    using V3 = glm::vec<3, S>;
+    using V4 = glm::vec<4, S>;
+    using std::atan2;
+    constexpr bool IS_FLOAT = std::is_same_v<S, float>;
+
+    if constexpr (!F.diagnostics || !IS_FLOAT) record = false;
+    const float rho = 1.225f;
+    const V3 gravity_world(0.0f, -9.81f, 0.0f);
 
     // --- 1) Kinematics: world <-> body frames using quaternion ---
     // Body-to-world: orientation * v_body
     // World-to-body: conj(orientation) * v_world
-    glm::quat q = plane.orientation;
-    glm::quat q_conj = glm::conjugate(q);
+    const glm::qua<S>& q = s.orientation;
+    glm::qua<S> q_conj = glm::conjugate(q);
 
     // Transform velocity to body frame:
-    glm::vec3 vel_body = glm::vec3(q_conj * glm::vec4(plane.velocity, 0.0f));
+    V3 vel_body = V3(q_conj * V4(s.velocity, 0.0f));
 
-    float V = glm::length(plane.velocity);
+    S V = glm::length(s.velocity);
     if (V < 1e-6f) V = 1e-6f; // avoid issues
 
-    // AoA (deg) and sideslip (deg) in body frame
+    // AoA (deg) in body frame (sideslip below, only the stability model uses it)
     // Using convention: x_body = forward, y_body = up, z_body = right (wing span along z)
-    float aoa_rad = std::atan2(vel_body.y, vel_body.x); // positive nose-up
-    float beta_rad = std::atan2(vel_body.z, vel_body.x); // sideslip (right positive)
-    float aoa_deg = aoa_rad * RAD2DEG;
-    float beta_deg = beta_rad * RAD2DEG;
+    S aoa_rad = atan2(vel_body.y, vel_body.x); // positive nose-up
+    S aoa_deg = aoa_rad * RAD2DEG;
 
-    // Round AoA to quarter-degree as before (for airfoil table sampling)
-    aoa_deg = roundToQuarter(aoa_deg);
+    // --- 2-4 (lattice / strip mode): distributed loads replace the lumped wing ---
+    if constexpr (IS_FLOAT) {
+        // Round AoA to quarter-degree as before (for airfoil table sampling)
+        if (quantizeAoA) aoa_deg = roundToQuarter(aoa_deg);
 
-    // --- 2) Aerodynamics: get coefficients using paper model ---
-    float AR = (plane.wingArea > 1e-6f) ? (plane.wingspan * plane.wingspan / plane.wingArea) : 1.0f;
-    const float Cd0 = 0.02f;
-    AeroCoeffs coeffs = computeAeroCoeffsPaper(aoa_deg, AR, Cd0);
+        if (plane.lattice) {
+            StripLoads loads = plane.lattice->evaluate(vel_body, s.angularVelocity, controls, rho);
+            return rigidDerivative<F>(plane, s, bodyLoadsForce(plane, s, V, thrust, loads, record), loads.moment, record);
+        }
+        if (plane.strips) {
+            StripLoads loads = plane.strips->evaluate(vel_body, s.angularVelocity, controls, rho);
+            return rigidDerivative<F>(plane, s, bodyLoadsForce(plane, s, V, thrust, loads, record), loads.moment, record);
+        }
+    } else if (plane.lattice || plane.strips) {
+        const S nan = std::numeric_limits<float>::quiet_NaN();
+        RigidDerivativeOf<S> d;
+        d.dPosition = d.dVelocity = d.dAngularVelocity = V3(nan);
+        d.dOrientation = glm::qua<S>(nan, nan, nan, nan);
+        return d;
+    }
+
+    // --- 2) Aerodynamics: paper-model coefficients from the tabulated LUT ---
+    float AR = aspectRatio(plane);
+    const AirfoilProperties& props = plane.airfoil.properties();
+    if (!plane.aeroTable || !plane.aeroTable->matches(AR, props))
+        plane.aeroTable = acquireAeroCoeffTable(AR, props);
+    S Cl, Cd, Cm, Cl_roll = 0.0f, Cn_yaw = 0.0f;
+    if constexpr (IS_FLOAT) {
+        AeroCoeffs coeffs = quantizeAoA ? plane.aeroTable->lookup(aoa_deg) : plane.aeroTable->lookupLinear(aoa_deg);
+        Cl = coeffs.Cl;
+        Cd = coeffs.Cd;
+        Cm = coeffs.Cm;
+    } else {
+        lookupLinear(*plane.aeroTable, aoa_deg, Cl, Cd, Cm);
+    }
+    AERO_STAT(++stats.steps;
+              ++stats.aoa[AeroStats::aoaBin(scalarValue(aoa_deg))];
+              ++(std::fabs(scalarValue(aoa_deg)) <= props.stallDeg ? stats.linear : stats.postStall));
+
+    // --- 2b) Stability/control derivatives: one fused (alpha, beta) lookup ---
+    S CY = 0.0f;
+    S dCm = 0.0f;
+    if (plane.stability) {
+        S beta_rad = atan2(vel_body.z, vel_body.x); // sideslip (right positive)
+        S beta_deg = beta_rad * RAD2DEG;
+        StabilityCoeffs sd, sdAlpha{}, sdBeta{};
+        if constexpr (IS_FLOAT)
+            sd = plane.stability->sample(aoa_deg, beta_deg, &plane.stabilityHint);
+        else
+            sd = plane.stability->sample(scalarValue(aoa_deg), scalarValue(beta_deg), sdAlpha, sdBeta,
+                                         &plane.stabilityHint);
+        auto field = [&](float StabilityCoeffs::*f) {
+            return stabilityField<S>(sd.*f, sdAlpha.*f, sdBeta.*f, aoa_deg, beta_deg);
+        };
+        // The table is in the usual aero axes (x forward, y right, z down);
+        // the body frame is x forward, y up, z span (right). So p = w.x,
+        // q (pitch, about the span) = w.z and r (yaw, nose right) = -w.y.
+        const V3& w = s.angularVelocity;
+        const V3& d = controls;                // (aileron, elevator, rudder)
+        const S p_hat = w.x * plane.wingspan / (2.0f * V);
+        const S q_hat = w.z * plane.chord / (2.0f * V);
+        const S r_hat = -w.y * plane.wingspan / (2.0f * V);
+
+        CY = field(&StabilityCoeffs::CY) + field(&StabilityCoeffs::CY_dr) * d.z;
+        Cl += field(&StabilityCoeffs::CL_de) * d.y;
+        Cl_roll = field(&StabilityCoeffs::Cl) + field(&StabilityCoeffs::Cl_p) * p_hat + field(&StabilityCoeffs::Cl_r) * r_hat +
+                  field(&StabilityCoeffs::Cl_da) * d.x + field(&StabilityCoeffs::Cl_dr) * d.z;
+        Cn_yaw  = field(&StabilityCoeffs::Cn) + field(&StabilityCoeffs::Cn_p) * p_hat + field(&StabilityCoeffs::Cn_r) * r_hat +
+                  field(&StabilityCoeffs::Cn_da) * d.x + field(&StabilityCoeffs::Cn_dr) * d.z;
+        dCm = field(&StabilityCoeffs::Cm_q) * q_hat + field(&StabilityCoeffs::Cm_de) * d.y;
+    }
 
     // --- 3) Compute forces in body frame ---
     // dynamic pressure (use inertial speed)
-    float qdyn = 0.5f * rho * V * V;
+    S qdyn = 0.5f * rho * V * V;
 
     // Lift direction in body frame: perpendicular to velocity and wing axis (z_body)
-    glm::vec3 v_body_norm = glm::normalize(vel_body);
-    glm::vec3 wingAxis_body(0.0f, 0.0f, 1.0f); // spanwise along +z in body
-    glm::vec3 liftDir_body = glm::cross(glm::cross(v_body_norm, wingAxis_body), v_body_norm);
-    if (glm::length(liftDir_body) < 1e-6f) {
+    V3 v_body_norm = glm::normalize(vel_body);
+    V3 wingAxis_body(0.0f, 0.0f, 1.0f); // spanwise along +z in body
+    V3 liftDir_body = glm::cross(glm::cross(v_body_norm, wingAxis_body), v_body_norm);
+    if (F.liftFallback && glm::length(liftDir_body) < 1e-6f) {
+        AERO_STAT(++stats.liftDirFallback);
         // fallback: use body up
-        liftDir_body = glm::vec3(0.0f, 1.0f, 0.0f);
+        liftDir_body = V3(0.0f, 1.0f, 0.0f);
     } else {
         liftDir_body = glm::normalize(liftDir_body);
     }
-    glm::vec3 dragDir_body = -v_body_norm; // opposite velocity in body
+    V3 dragDir_body = -v_body_norm; // opposite velocity in body
 
     // Compute body-frame force vectors
-    glm::vec3 lift_body = liftDir_body * (qdyn * plane.wingArea * coeffs.Cl);
-    glm::vec3 drag_body = dragDir_body * (qdyn * plane.wingArea * coeffs.Cd);
-    glm::vec3 thrust_body = glm::vec3(1.0f, 0.0f, 0.0f) * plane.thrust; // thrust along body +X
-
-    // Transform forces to world frame
-    glm::vec3 lift_world = glm::vec3(q * glm::vec4(lift_body, 0.0f));
-    glm::vec3 drag_world = glm::vec3(q * glm::vec4(drag_body, 0.0f));
-    glm::vec3 thrust_world = glm::vec3(q * glm::vec4(thrust_body, 0.0f));
-
-    // Save for debug/consumer code
-    plane.lift = lift_world;
-    plane.drag = drag_world;
-    plane.thrustVec = thrust_world;
-
-    // Sum forces in world frame and integrate linear motion
-    plane.totalForce = lift_world + drag_world + thrust_world + gravity_world * plane.mass;
-    plane.acceleration = plane.totalForce / plane.mass;
-
-    // Integrate linear kinematics (semi-implicit Euler)
-    plane.velocity += plane.acceleration * dt;
-    plane.position += plane.velocity * dt;
-
-    // --- 4) Compute aerodynamic moments in body frame ---
-    // Pitch moment (about body Y) using CM nondimensional: M_y = CM * q * S * c
-    float M_pitch = coeffs.Cm * qdyn * plane.wingArea * plane.chord;
-    // Other rotational moments (roll/yaw) are left 0 for now or can be added from control surfaces
-    float M_roll = 0.0f;
-    float M_yaw  = 0.0f;
-
-    // Compose body moment vector (Mx, My, Mz)
-    plane.bodyMoment = glm::vec3(M_roll, M_pitch, M_yaw);
-
-    // --- 5) Rotational dynamics: full rigid-body (body frame)
-    // inertia is diagonal (Ixx,Iyy,Izz) stored in plane.inertia, inverse in inertiaInv
-    glm::vec3 I = plane.inertia;
-    glm::vec3 Iinv = plane.inertiaInv;
-
-    // omega x (I * omega)
-    glm::vec3 Iomega = glm::vec3(I.x * plane.angularVelocity.x,
-                                 I.y * plane.angularVelocity.y,
-                                 I.z * plane.angularVelocity.z);
-    glm::vec3 omegaCrossIomega = glm::cross(plane.angularVelocity, Iomega);
-
-    // Euler rotational equation: I * domega = M - omega x (I*omega)
-    glm::vec3 domega;
-    domega.x = Iinv.x * (plane.bodyMoment.x - omegaCrossIomega.x);
-    domega.y = Iinv.y * (plane.bodyMoment.y - omegaCrossIomega.y);
-    domega.z = Iinv.z * (plane.bodyMoment.z - omegaCrossIomega.z);
-
-    // Integrate angular velocity
-    plane.angularAcceleration = domega;
-    plane.angularVelocity += plane.angularAcceleration * dt;
-
-    // --- 6) Integrate quaternion orientation using body angular rates (p,q,r)
-    // Quaternion kinematics: q_dot = 0.5 * q * omega_quat  (omega_quat = (0, ω_body))
-    glm::quat omega_quat(0.0f, plane.angularVelocity.x, plane.angularVelocity.y, plane.angularVelocity.z);
-    glm::quat qdot = 0.5f * (q * omega_quat);
-    plane.orientation = glm::normalize(q + qdot * dt);
-
-    // done
+    V3 lift_body = liftDir_body * (qdyn * plane.wingArea * Cl);
+    V3 drag_body = dragDir_body * (qdyn * plane.wingArea * Cd);
+    V3 thrust_body = V3(1.0f, 0.0f, 0.0f) * thrust; // thrust along body +X
+    V3 side_body = wingAxis_body * (qdyn * plane.wingArea * CY);   // side force along span
+
+    V3 totalForce;
+    if constexpr (F.diagnostics && IS_FLOAT) {
+        // Transform forces to world frame
+        V3 lift_world = V3(q * V4(lift_body, 0.0f));
+        V3 drag_world = V3(q * V4(drag_body, 0.0f));
+        V3 thrust_world = V3(q * V4(thrust_body, 0.0f));
+        V3 side_world = plane.stability ? V3(q * V4(side_body, 0.0f)) : V3(0.0f);
+
+        // Save for debug/consumer code
+        if (record) {
+            plane.lift = lift_world;
+            plane.drag = drag_world;
+            plane.thrustVec = thrust_world;
+        }
+
+        // Sum forces in world frame
+        totalForce = lift_world + drag_world + thrust_world + side_world + gravity_world * S(plane.mass);
+    } else {
+        // nobody looks at the parts (or can't: duals never record): one
+        // rotation of the body-frame sum
+        V3 force_body = lift_body + drag_body + thrust_body + side_body;
+        totalForce = V3(q * V4(force_body, 0.0f)) + gravity_world * S(plane.mass);
+    }
+
+    // --- 4) Compute aerodynamic moments in body frame (none for a point mass) ---
+    V3 bodyMoment(0.0f);
+    if constexpr (F.rotation) {
+        // Airfoil pitch moment using CM nondimensional: CM * q * S * c
+        S M_airfoil = Cm * qdyn * plane.wingArea * plane.chord;
+        // Stability model (zero without one), in aero axes: M = C * q * S * c
+        // or b. Roll is about x, pitch about z (the span), and yaw nose-right
+        // is about -y (y is up).
+        S M_pitch = dCm * qdyn * plane.wingArea * plane.chord;
+        S M_roll = Cl_roll * qdyn * plane.wingArea * plane.wingspan;
+        S M_yaw  = Cn_yaw * qdyn * plane.wingArea * plane.wingspan;
+
+        // Compose body moment vector (Mx, My, Mz). With a stability table the
+        // airfoil Cm joins Cm_q / Cm_de about the pitch axis (z), so the
+        // elevator trims it. The plain lumped model keeps applying it about
+        // body y, as it always has, so its trajectories stay bit-identical.
+        if (plane.stability)
+            bodyMoment = V3(M_roll, -M_yaw, M_airfoil + M_pitch);
+        else
+            bodyMoment = V3(M_roll, M_airfoil - M_yaw, M_pitch);
+    }
+    return rigidDerivative<F>(plane, s, totalForce, bodyMoment, record);
+}
+
+RigidDerivative aircraftDerivative(Aircraft& plane, const RigidState& s, bool record, bool quantizeAoA)
+{
+    return evaluateDerivative<FULL_PHYSICS>(plane, s, plane.thrust, plane.controls, record, quantizeAoA);
+}
+
+template <class S>
+RigidDerivativeOf<S> aircraftDerivative(Aircraft& plane, const RigidStateOf<S>& s, const S& thrust,
+                                        const glm::vec<3, S>& controls)
+{
+    return evaluateDerivative<FULL_PHYSICS>(plane, s, thrust, controls, false, false);
+}
+
+// add a line here for other scalars
+template RigidDerivativeOf<float> aircraftDerivative(Aircraft&, const RigidStateOf<float>&, const float&,
+                                                     const glm::vec<3, float>&);
+template RigidDerivativeOf<Dual<6>> aircraftDerivative(Aircraft&, const RigidStateOf<Dual<6>>&, const Dual<6>&,
+                                                       const glm::vec<3, Dual<6>>&);
+template RigidDerivativeOf<AircraftDual> aircraftDerivative(Aircraft&, const RigidStateOf<AircraftDual>&,
+                                                            const AircraftDual&, const glm::vec<3, AircraftDual>&);
+
+bool aircraftJacobian(Aircraft& plane, const RigidState& s, AircraftJacobian& out)
+{
+    if (!dualDerivatives(plane)) {
+        std::cerr << "aircraftJacobian: strip and lattice models have no dual-number path\n";
+        return false;
+    }
+    using D = AircraftDual;
+    auto var = [](float x, int i) { return D::variable(x, i); };
+
+    RigidStateOf<D> x;
+    x.position = glm::vec<3, D>(var(s.position.x, 0), var(s.position.y, 1), var(s.position.z, 2));
+    x.velocity = glm::vec<3, D>(var(s.velocity.x, 3), var(s.velocity.y, 4), var(s.velocity.z, 5));
+    x.orientation = glm::qua<D>(var(s.orientation.w, 6), var(s.orientation.x, 7), var(s.orientation.y, 8),
+                                var(s.orientation.z, 9));
+    x.angularVelocity = glm::vec<3, D>(var(s.angularVelocity.x, 10), var(s.angularVelocity.y, 11),
+                                       var(s.angularVelocity.z, 12));
+    D thrust = var(plane.thrust, AIRCRAFT_STATE_SIZE);
+    glm::vec<3, D> controls(var(plane.controls.x, AIRCRAFT_STATE_SIZE + 1), var(plane.controls.y, AIRCRAFT_STATE_SIZE + 2),
+                            var(plane.controls.z, AIRCRAFT_STATE_SIZE + 3));
+
+    RigidDerivativeOf<D> d = aircraftDerivative(plane, x, thrust, controls);
+
+    const D* rows[AIRCRAFT_STATE_SIZE] = {
+        &d.dPosition.x, &d.dPosition.y, &d.dPosition.z,
+        &d.dVelocity.x, &d.dVelocity.y, &d.dVelocity.z,
+        &d.dOrientation.w, &d.dOrientation.x, &d.dOrientation.y, &d.dOrientation.z,
+        &d.dAngularVelocity.x, &d.dAngularVelocity.y, &d.dAngularVelocity.z,
+    };
+    float* f[AIRCRAFT_STATE_SIZE] = {
+        &out.f.dPosition.x, &out.f.dPosition.y, &out.f.dPosition.z,
+        &out.f.dVelocity.x, &out.f.dVelocity.y, &out.f.dVelocity.z,
+        &out.f.dOrientation.w, &out.f.dOrientation.x, &out.f.dOrientation.y, &out.f.dOrientation.z,
+        &out.f.dAngularVelocity.x, &out.f.dAngularVelocity.y, &out.f.dAngularVelocity.z,
+    };
+    for (int i = 0; i < AIRCRAFT_STATE_SIZE; ++i) {
+        *f[i] = rows[i]->v;
+        for (int j = 0; j < AIRCRAFT_STATE_SIZE; ++j) out.A[i][j] = rows[i]->d[j];
+        for (int j = 0; j < AIRCRAFT_INPUT_SIZE; ++j) out.B[i][j] = rows[i]->d[AIRCRAFT_STATE_SIZE + j];
+    }
+    return true;
+}
+
+// ---------------------------
+// Physics Update: semi-implicit Euler
+// ---------------------------
+void updatePhysics(Aircraft& plane, float /*aoa_unused*/, float /*sideslip_unused*/, float dt)
+{
+    updatePhysics<SemiImplicitEuler>(plane, dt);
 }
+
+// ---------------------------
+// Physics Update: compile-time feature variants
+// ---------------------------
+template <PhysicsFeatures F>
+void updatePhysics(Aircraft& plane, float dt)
+{
+    if (dt <= 0.0f) return;
+    RigidState s = aircraftState(plane);
+    RigidDerivative d = evaluateDerivative<F>(plane, s, plane.thrust, plane.controls, true, true);
+    if constexpr (F.rotation) {
+        SemiImplicitEuler euler;
+        euler.rotation = plane.orientationUpdate;
+        euler.step([&](const RigidState&) { return d; }, s, dt);
+        setAircraftState(plane, s);
+    } else {
+        // point mass: attitude and rates are left to the caller
+        plane.velocity += d.dVelocity * dt;
+        plane.position += plane.velocity * dt;
+    }
+}
+
+// add a line here for other combinations
+template void updatePhysics<FULL_PHYSICS>(Aircraft&, float);
+template void updatePhysics<NO_DIAGNOSTICS_PHYSICS>(Aircraft&, float);
+template void updatePhysics<NO_GYRO_PHYSICS>(Aircraft&, float);
+template void updatePhysics<POINT_MASS_PHYSICS>(Aircraft&, float);
  
+// ---------------------------
+// Lattice batching: aircraft sharing a VortexLattice get one batched solve
+// ---------------------------
+// use(i, loads) for every planes[grouped[k]], in lattice-pointer order
+template <class Use>
+static void forEachLatticeGroup(Aircraft* planes, std::vector<size_t>& grouped, Use&& use)
+{
+    std::stable_sort(grouped.begin(), grouped.end(), [&](size_t a, size_t b) {
+        return planes[a].lattice.get() < planes[b].lattice.get();
+    });
+
+    std::vector<glm::vec3> vel, omega, controls;
+    std::vector<StripLoads> loads;
+    for (size_t g0 = 0; g0 < grouped.size();) {
+        const VortexLattice* vl = planes[grouped[g0]].lattice.get();
+        size_t g1 = g0;
+        while (g1 < grouped.size() && planes[grouped[g1]].lattice.get() == vl) ++g1;
+
+        const size_t m = g1 - g0;
+        vel.resize(m); omega.resize(m); controls.resize(m); loads.resize(m);
+        for (size_t k = 0; k < m; ++k) {
+            const Aircraft& p = planes[grouped[g0 + k]];
+            vel[k] = glm::vec3(glm::conjugate(p.orientation) * glm::vec4(p.velocity, 0.0f));
+            omega[k] = p.angularVelocity;
+            controls[k] = p.controls;
+        }
+        vl->evaluateBatch(vel.data(), omega.data(), controls.data(), loads.data(), m);
+
+        for (size_t k = 0; k < m; ++k) use(grouped[g0 + k], loads[k]);
+        g0 = g1;
+    }
+}
+
+void aircraftDerivatives(Aircraft* planes, size_t count, RigidDerivative* out, bool quantizeAoA)
+{
+    std::vector<size_t> grouped;
+    for (size_t i = 0; i < count; ++i) {
+        if (planes[i].lattice) grouped.push_back(i);
+        else out[i] = evaluateDerivative<FULL_PHYSICS>(planes[i], aircraftState(planes[i]), planes[i].thrust, planes[i].controls,
+                                                  false, quantizeAoA);
+    }
+    forEachLatticeGroup(planes, grouped, [&](size_t i, const StripLoads& loads) {
+        Aircraft& p = planes[i];
+        RigidState st = aircraftState(p);
+        float V = std::max(glm::length(p.velocity), 1e-6f);
+        out[i] = rigidDerivative<FULL_PHYSICS>(p, st, bodyLoadsForce(p, st, V, p.thrust, loads, false), loads.moment, false);
+    });
+}
+
+// ---------------------------
+// Group update
+// ---------------------------
+void updatePhysics(Aircraft* planes, size_t count, float dt)
+{
+    if (dt <= 0.0f) return;
+
+    std::vector<size_t> grouped;
+    for (size_t i = 0; i < count; ++i) {
+        if (planes[i].lattice) grouped.push_back(i);
+        else updatePhysics(planes[i], 0.0f, 0.0f, dt);
+    }
+    forEachLatticeGroup(planes, grouped, [&](size_t i, const StripLoads& loads) {
+        Aircraft& p = planes[i];
+        RigidState st = aircraftState(p);
+        float V = std::max(glm::length(p.velocity), 1e-6f);
+        RigidDerivative d = rigidDerivative<FULL_PHYSICS>(p, st, bodyLoadsForce(p, st, V, p.thrust, loads, true), loads.moment, true);
+        SemiImplicitEuler euler;
+        euler.rotation = p.orientationUpdate;
+        euler.step([&](const RigidState&) { return d; }, st, dt);
+        setAircraftState(p, st);
+    });
+}
+
+void updatePhysics(ThreadPool& pool, Aircraft* planes, size_t count, float dt, size_t chunk)
+{
+    if (dt <= 0.0f) return;
+    pool.parallelFor(count, chunk, [&](size_t begin, size_t end, unsigned) {
+        updatePhysics(planes + begin, end - begin, dt);
+    });
+}
+
 // ---------------------------
 // Factory
 // ---------------------------
@@ -321,7 +761,8 @@ Aircraft createAirplane(const Airfoil& foil,
                         float wingspan,
                         float chord,
                         float thrust,
-                        glm::vec3 inertiaPrincipal)
+                        glm::vec3 inertiaPrincipal,
+                        bool sharedAeroTable)
 {
     Aircraft plane(foil);
     plane.position = position;
@@ -340,6 +781,8 @@ Aircraft createAirplane(const Airfoil& foil,
     plane.chord = chord;
     plane.thrust = thrust;
 
+    if (sharedAeroTable) plane.aeroTable = acquireAeroCoeffTable(aspectRatio(plane), plane.airfoil.properties());
+
     plane.inertia = inertiaPrincipal;
     plane.inertiaInv = glm::vec3(
         (inertiaPrincipal.x > 1e-9f) ? 1.0f / inertiaPrincipal.x : 0.0f,
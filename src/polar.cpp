@@ -0,0 +1,242 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "physicsengine.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <utility>
+
+static constexpr size_t CACHE_LINE = 64;
+
+static size_t alignUp(size_t n, size_t a) { return (n + a - 1) / a * a; }
+
+// FNV-1a over raw bytes
+static uint64_t hashBytes(const void* p, size_t n, uint64_t h = 1469598103934665603ull)
+{
+    const unsigned char* b = static_cast<const unsigned char*>(p);
+    for (size_t i = 0; i < n; ++i) {
+        h ^= b[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// ---------------------------
+// PolarData
+// ---------------------------
+size_t PolarData::segmentIndex(float alpha_deg) const
+{
+    const size_t last = segmentCount - 1;
+    size_t i = size_t((alpha_deg - min_alpha) * inv_step);
+    if (uniform) return std::min(i, last);
+
+    i = bracket[std::min<size_t>(i, bracketCount - 1)];
+    while (i < last && alpha_deg >= segments[i + 1].alpha) ++i;
+    return i;
+}
+
+// Fritsch-Carlson node slopes (per deg) for one coefficient column
+static void pchipSlopes(const std::vector<glm::vec4>& curve, int col, std::vector<float>& m)
+{
+    const size_t n = curve.size();
+    m.assign(n, 0.0f);
+    if (n < 2) return;
+
+    std::vector<float> h(n - 1), delta(n - 1);
+    for (size_t k = 0; k + 1 < n; ++k) {
+        h[k] = curve[k + 1].x - curve[k].x;
+        delta[k] = (h[k] > 1e-9f) ? (curve[k + 1][col] - curve[k][col]) / h[k] : 0.0f;
+    }
+    if (n == 2) { m[0] = m[1] = delta[0]; return; }
+
+    // interior: weighted harmonic mean, zero at local extrema
+    for (size_t k = 1; k + 1 < n; ++k) {
+        if (delta[k - 1] * delta[k] <= 0.0f) continue;
+        float w1 = 2.0f * h[k] + h[k - 1];
+        float w2 = h[k] + 2.0f * h[k - 1];
+        m[k] = (w1 + w2) / (w1 / delta[k - 1] + w2 / delta[k]);
+    }
+
+    // ends: shape-preserving three-point formula
+    auto edge = [](float h0, float h1, float d0, float d1) {
+        float s = ((2.0f * h0 + h1) * d0 - h0 * d1) / (h0 + h1);
+        if (s * d0 <= 0.0f) return 0.0f;
+        if (d0 * d1 < 0.0f && std::fabs(s) > std::fabs(3.0f * d0)) return 3.0f * d0;
+        return s;
+    };
+    m[0] = edge(h[0], h[1], delta[0], delta[1]);
+    m[n - 1] = edge(h[n - 2], h[n - 3], delta[n - 2], delta[n - 3]);
+}
+
+std::shared_ptr<const PolarData> buildPolar(const std::vector<glm::vec4>& curve, PolarInterpolation mode)
+{
+    auto polar = std::make_shared<PolarData>();
+    if (curve.empty()) return polar;
+
+    const size_t n = curve.size();
+    const size_t segCount = (n > 1) ? n - 1 : 1;
+    const float min_alpha = curve.front().x;
+    const float max_alpha = curve.back().x;
+
+    // per-interval node/slope records
+    std::vector<PolarSegment> segs(segCount);
+    float min_width = 0.0f;
+    for (size_t i = 0; i < segCount; ++i) {
+        const glm::vec4& a = curve[i];
+        const glm::vec4& b = (i + 1 < n) ? curve[i + 1] : curve[i];
+        float w = b.x - a.x;
+        float inv = (w > 1e-9f) ? 1.0f / w : 0.0f;
+        PolarSegment& s = segs[i];
+        s.alpha = a.x;
+        s.Cl = a.y; s.Cd = a.z; s.Cm = a.w;
+        s.dCl = (b.y - a.y) * inv;
+        s.dCd = (b.z - a.z) * inv;
+        s.dCm = (b.w - a.w) * inv;
+        s.width = w;
+        if (w > 1e-9f && (min_width == 0.0f || w < min_width)) min_width = w;
+    }
+
+    bool uniform = true;
+    float inv_step = 0.0f;
+    std::vector<uint32_t> bracket;
+
+    if (n >= 2 && min_width > 0.0f) {
+        // uniform grid check: every interval within a small tolerance of the mean step
+        const float step = (max_alpha - min_alpha) / float(n - 1);
+        for (const PolarSegment& s : segs) {
+            if (std::fabs(s.width - step) > 1e-3f * step) { uniform = false; break; }
+        }
+
+        if (uniform) {
+            inv_step = 1.0f / step;
+        } else {
+            // non-uniform: bucket grid no coarser than the narrowest interval, so each
+            // bucket overlaps at most two segments (capped for pathological tables)
+            const size_t max_buckets = size_t(1) << 16;
+            size_t buckets = size_t(std::ceil((max_alpha - min_alpha) / min_width)) + 1;
+            buckets = std::min(buckets, max_buckets);
+            inv_step = float(buckets - 1) / (max_alpha - min_alpha);
+
+            bracket.resize(buckets);
+            size_t seg = 0;
+            for (size_t k = 0; k < buckets; ++k) {
+                float a = min_alpha + float(k) / inv_step;
+                while (seg + 1 < segCount && a >= segs[seg + 1].alpha) ++seg;
+                bracket[k] = uint32_t(seg);
+            }
+        }
+    }
+
+    // monotone cubic: per-interval Horner coefficients from PCHIP node slopes
+    std::vector<PolarCubicSegment> cubic;
+    if (mode == PolarInterpolation::MonotoneCubic) {
+        std::vector<float> m[3];
+        for (int col = 0; col < 3; ++col) pchipSlopes(curve, col + 1, m[col]);
+
+        cubic.resize(segCount);
+        for (size_t i = 0; i < segCount; ++i) {
+            const size_t j = (i + 1 < n) ? i + 1 : i;
+            const float h = segs[i].width;
+            const float inv = (h > 1e-9f) ? 1.0f / h : 0.0f;
+            PolarCubicSegment& c = cubic[i];
+            for (int col = 0; col < 3; ++col) {
+                float y0 = curve[i][col + 1];
+                float d = (curve[j][col + 1] - y0) * inv;
+                float m0 = m[col][i], m1 = m[col][j];
+                c.c[0][col] = y0;
+                c.c[1][col] = m0;
+                c.c[2][col] = (3.0f * d - 2.0f * m0 - m1) * inv;
+                c.c[3][col] = (m0 + m1 - 2.0f * d) * inv * inv;
+            }
+            c.c[0].w = segs[i].alpha;
+            c.c[1].w = c.c[2].w = c.c[3].w = 0.0f;
+        }
+    }
+
+    // one cache-aligned block: segments, then bracket and cubic on following lines
+    const size_t segBytes = segCount * sizeof(PolarSegment);
+    const size_t bracketOffset = alignUp(segBytes, CACHE_LINE);
+    const size_t cubicOffset = alignUp(bracketOffset + bracket.size() * sizeof(uint32_t), CACHE_LINE);
+    const size_t cubicBytes = cubic.size() * sizeof(PolarCubicSegment);
+    const size_t total = alignUp(cubicOffset + cubicBytes, CACHE_LINE);
+
+    void* block = ::operator new(total, std::align_val_t(CACHE_LINE));
+    std::memcpy(block, segs.data(), segBytes);
+    if (!bracket.empty())
+        std::memcpy(static_cast<char*>(block) + bracketOffset, bracket.data(), bracket.size() * sizeof(uint32_t));
+    if (!cubic.empty())
+        std::memcpy(static_cast<char*>(block) + cubicOffset, cubic.data(), cubicBytes);
+
+    polar->storage = std::shared_ptr<const void>(block, [](const void* b) {
+        ::operator delete(const_cast<void*>(b), std::align_val_t(CACHE_LINE));
+    });
+    polar->segments = static_cast<const PolarSegment*>(block);
+    polar->bracket = bracket.empty() ? nullptr
+                                     : reinterpret_cast<const uint32_t*>(static_cast<const char*>(block) + bracketOffset);
+    polar->cubic = cubic.empty() ? nullptr
+                                 : reinterpret_cast<const PolarCubicSegment*>(static_cast<const char*>(block) + cubicOffset);
+    polar->segmentCount = uint32_t(segCount);
+    polar->bracketCount = uint32_t(bracket.size());
+    polar->min_alpha = min_alpha;
+    polar->max_alpha = max_alpha;
+    polar->inv_step = inv_step;
+    polar->uniform = uniform;
+    polar->hash = hashBytes(polar->segments, segBytes);
+    if (polar->cubic) polar->hash = hashBytes(polar->cubic, cubicBytes, polar->hash);
+    polar->properties = computeAirfoilProperties(polar->segments, segCount);
+    return polar;
+}
+
+// ---------------------------
+// Polar Registry
+// ---------------------------
+namespace {
+std::mutex registryMutex;
+std::unordered_map<uint64_t, std::vector<std::weak_ptr<const PolarData>>> registry;
+
+bool samePolar(const PolarData& a, const PolarData& b)
+{
+    if (a.segmentCount != b.segmentCount || (a.cubic == nullptr) != (b.cubic == nullptr)) return false;
+    if (a.segmentCount == 0) return true;
+    return std::memcmp(a.segments, b.segments, a.segmentCount * sizeof(PolarSegment)) == 0 &&
+           (!a.cubic || std::memcmp(a.cubic, b.cubic, a.segmentCount * sizeof(PolarCubicSegment)) == 0);
+}
+} // namespace
+
+std::shared_ptr<const PolarData> internPolar(std::shared_ptr<const PolarData> polar)
+{
+    if (!polar) polar = buildPolar({});
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto& bucket = registry[polar->hash];
+
+    // drop expired entries while scanning for a live match
+    for (size_t i = 0; i < bucket.size();) {
+        if (auto live = bucket[i].lock()) {
+            if (live == polar || samePolar(*live, *polar)) return live;
+            ++i;
+        } else {
+            bucket[i] = bucket.back();
+            bucket.pop_back();
+        }
+    }
+    bucket.push_back(polar);
+    return polar;
+}
+
+std::shared_ptr<const PolarData> acquirePolar(const std::vector<glm::vec4>& curve, PolarInterpolation mode)
+{
+    return internPolar(buildPolar(curve, mode));
+}
+
+size_t livePolarCount()
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    size_t count = 0;
+    for (const auto& entry : registry)
+        for (const auto& w : entry.second)
+            if (!w.expired()) ++count;
+    return count;
+}
@@ -0,0 +1,244 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "polardb.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static uint64_t alignUp(uint64_t n, uint64_t a) { return (n + a - 1) / a * a; }
+
+// ---------------------------
+// Writer
+// ---------------------------
+bool writePolarDatabase(const std::string& path, const std::vector<PolarDbSource>& airfoils)
+{
+    // lay out every block first, then stream the file front to back
+    std::vector<PolarDbEntry> dir(airfoils.size());
+    std::vector<std::shared_ptr<const PolarData>> polars(airfoils.size());
+
+    uint64_t offset = alignUp(sizeof(PolarDbHeader) + dir.size() * sizeof(PolarDbEntry), POLARDB_ALIGN);
+    for (size_t i = 0; i < airfoils.size(); ++i) {
+        const PolarDbSource& src = airfoils[i];
+        if (src.curve.empty()) {
+            std::cerr << "writePolarDatabase: airfoil '" << src.name << "' has no rows\n";
+            return false;
+        }
+        const PolarData& p = *(polars[i] = buildPolar(src.curve));
+        PolarDbEntry& e = dir[i];
+        std::memset(&e, 0, sizeof(e));
+        std::strncpy(e.name, src.name.c_str(), sizeof(e.name) - 1);
+        e.rowCount = uint32_t(src.curve.size());
+        e.segmentCount = p.segmentCount;
+        e.bracketCount = p.bracketCount;
+        e.flags = p.uniform ? POLARDB_UNIFORM : 0u;
+        e.min_alpha = p.min_alpha;
+        e.max_alpha = p.max_alpha;
+        e.inv_step = p.inv_step;
+        e.columnStride = uint32_t(alignUp(e.rowCount * sizeof(float), POLARDB_ALIGN));
+        e.hash = p.hash;
+
+        e.columnsOffset = offset;
+        offset += 4ull * e.columnStride;
+        e.segmentsOffset = offset;
+        offset = alignUp(offset + e.segmentCount * sizeof(PolarSegment), POLARDB_ALIGN);
+        e.bracketOffset = e.bracketCount ? offset : 0;
+        offset = alignUp(offset + e.bracketCount * sizeof(uint32_t), POLARDB_ALIGN);
+    }
+
+    PolarDbHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, POLARDB_MAGIC, sizeof(header.magic));
+    header.version = POLARDB_VERSION;
+    header.airfoilCount = uint32_t(dir.size());
+    header.directoryOffset = sizeof(PolarDbHeader);
+    header.fileSize = offset;
+
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) { std::cerr << "writePolarDatabase: cannot open " << path << "\n"; return false; }
+
+    uint64_t written = 0;
+    auto put = [&](const void* data, size_t bytes) {
+        if (bytes && std::fwrite(data, 1, bytes, f) != bytes) return false;
+        written += bytes;
+        return true;
+    };
+    auto padTo = [&](uint64_t target) {
+        static const unsigned char zeros[POLARDB_ALIGN] = {};
+        while (written < target) {
+            size_t n = size_t(std::min<uint64_t>(target - written, sizeof(zeros)));
+            if (!put(zeros, n)) return false;
+        }
+        return true;
+    };
+
+    bool ok = put(&header, sizeof(header)) && put(dir.data(), dir.size() * sizeof(PolarDbEntry));
+    std::vector<float> column;
+    for (size_t i = 0; ok && i < airfoils.size(); ++i) {
+        const PolarDbEntry& e = dir[i];
+        const std::vector<glm::vec4>& curve = airfoils[i].curve;
+        column.resize(curve.size());
+        for (int c = 0; ok && c < 4; ++c) {
+            for (size_t r = 0; r < curve.size(); ++r) column[r] = curve[r][c];
+            ok = padTo(e.columnsOffset + uint64_t(c) * e.columnStride) &&
+                 put(column.data(), column.size() * sizeof(float));
+        }
+        ok = ok && padTo(e.segmentsOffset) && put(polars[i]->segments, e.segmentCount * sizeof(PolarSegment));
+        if (e.bracketCount)
+            ok = ok && padTo(e.bracketOffset) && put(polars[i]->bracket, e.bracketCount * sizeof(uint32_t));
+    }
+    ok = ok && padTo(header.fileSize);
+
+    if (std::fclose(f) != 0) ok = false;
+    if (!ok) std::cerr << "writePolarDatabase: write failed for " << path << "\n";
+    return ok;
+}
+
+// ---------------------------
+// Reader
+// ---------------------------
+std::shared_ptr<const PolarDatabase> PolarDatabase::open(const std::string& path)
+{
+    std::shared_ptr<PolarDatabase> db(new PolarDatabase());
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) { std::cerr << "PolarDatabase: cannot open " << path << "\n"; return nullptr; }
+    db->fileHandle = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        std::cerr << "PolarDatabase: empty file " << path << "\n";
+        return nullptr;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) { std::cerr << "PolarDatabase: mapping failed for " << path << "\n"; return nullptr; }
+    db->mappingHandle = mapping;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) { std::cerr << "PolarDatabase: mapping failed for " << path << "\n"; return nullptr; }
+    db->base = static_cast<const unsigned char*>(view);
+    db->length = size_t(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { std::cerr << "PolarDatabase: cannot open " << path << "\n"; return nullptr; }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        std::cerr << "PolarDatabase: empty file " << path << "\n";
+        ::close(fd);
+        return nullptr;
+    }
+    void* view = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping stays valid
+    if (view == MAP_FAILED) { std::cerr << "PolarDatabase: mmap failed for " << path << "\n"; return nullptr; }
+    db->base = static_cast<const unsigned char*>(view);
+    db->length = size_t(st.st_size);
+#endif
+
+    // validate header and directory, then each airfoil's blocks: the
+    // offsets, the segment count against the rows, a usable inv_step and
+    // every bracket entry naming a segment - what segmentIndex relies on.
+    // Segment contents (alphas, coefficients) are taken as written.
+    const PolarDbHeader* h = reinterpret_cast<const PolarDbHeader*>(db->base);
+    if (db->length < sizeof(PolarDbHeader) || std::memcmp(h->magic, POLARDB_MAGIC, sizeof(h->magic)) != 0) {
+        std::cerr << "PolarDatabase: " << path << " is not a polar database\n";
+        return nullptr;
+    }
+    if (h->version != POLARDB_VERSION) {
+        std::cerr << "PolarDatabase: " << path << " has version " << h->version
+                  << ", expected " << POLARDB_VERSION << "\n";
+        return nullptr;
+    }
+
+    auto inFile = [&](uint64_t off, uint64_t bytes, uint64_t align) {
+        return off % align == 0 && off <= db->length && bytes <= db->length - off;
+    };
+    if (h->fileSize != db->length ||
+        !inFile(h->directoryOffset, uint64_t(h->airfoilCount) * sizeof(PolarDbEntry), alignof(PolarDbEntry))) {
+        std::cerr << "PolarDatabase: " << path << " is truncated\n";
+        return nullptr;
+    }
+
+    db->directory = reinterpret_cast<const PolarDbEntry*>(db->base + h->directoryOffset);
+    db->count = h->airfoilCount;
+
+    for (size_t i = 0; i < db->count; ++i) {
+        const PolarDbEntry& e = db->directory[i];
+        bool ok = e.name[sizeof(e.name) - 1] == '\0' &&
+                  e.columnStride >= e.rowCount * sizeof(float) &&
+                  inFile(e.columnsOffset, 4ull * e.columnStride, POLARDB_ALIGN) &&
+                  inFile(e.segmentsOffset, uint64_t(e.segmentCount) * sizeof(PolarSegment), POLARDB_ALIGN) &&
+                  (e.bracketCount == 0 ||
+                   inFile(e.bracketOffset, uint64_t(e.bracketCount) * sizeof(uint32_t), POLARDB_ALIGN)) &&
+                  ((e.flags & POLARDB_UNIFORM) || e.bracketCount != 0 || e.segmentCount <= 1) &&
+                  e.segmentCount >= 1 && e.segmentCount == std::max<uint32_t>(e.rowCount, 2) - 1 &&
+                  std::isfinite(e.min_alpha) && std::isfinite(e.max_alpha) && std::isfinite(e.inv_step) &&
+                  // a single row (or all rows at one alpha) is stored with inv_step 0
+                  (e.inv_step > 0.0f || (e.inv_step == 0.0f && (e.flags & POLARDB_UNIFORM)));
+        if (ok && e.bracketCount) {
+            const uint32_t* bracket = reinterpret_cast<const uint32_t*>(db->base + e.bracketOffset);
+            for (uint32_t k = 0; ok && k < e.bracketCount; ++k) ok = bracket[k] < e.segmentCount;
+        }
+        if (!ok) {
+            std::cerr << "PolarDatabase: " << path << " has a corrupt entry at index " << i << "\n";
+            return nullptr;
+        }
+    }
+
+    return db;
+}
+
+PolarDatabase::~PolarDatabase()
+{
+#ifdef _WIN32
+    if (base) UnmapViewOfFile(base);
+    if (mappingHandle) CloseHandle(static_cast<HANDLE>(mappingHandle));
+    if (fileHandle) CloseHandle(static_cast<HANDLE>(fileHandle));
+#else
+    if (base) munmap(const_cast<unsigned char*>(base), length);
+#endif
+}
+
+long PolarDatabase::find(const std::string& name) const
+{
+    for (size_t i = 0; i < count; ++i)
+        if (name == directory[i].name) return long(i);
+    return -1;
+}
+
+const float* PolarDatabase::column(size_t i, int col) const
+{
+    const PolarDbEntry& e = directory[i];
+    return reinterpret_cast<const float*>(base + e.columnsOffset + uint64_t(col) * e.columnStride);
+}
+
+std::shared_ptr<const PolarData> PolarDatabase::polar(size_t i) const
+{
+    const PolarDbEntry& e = directory[i];
+    auto p = std::make_shared<PolarData>();
+    p->segments = e.segmentCount ? reinterpret_cast<const PolarSegment*>(base + e.segmentsOffset) : nullptr;
+    p->bracket = e.bracketCount ? reinterpret_cast<const uint32_t*>(base + e.bracketOffset) : nullptr;
+    p->segmentCount = e.segmentCount;
+    p->bracketCount = e.bracketCount;
+    p->min_alpha = e.min_alpha;
+    p->max_alpha = e.max_alpha;
+    p->inv_step = e.inv_step;
+    p->uniform = (e.flags & POLARDB_UNIFORM) != 0;
+    p->hash = e.hash;
+    p->properties = computeAirfoilProperties(p->segments, e.segmentCount);
+    p->storage = shared_from_this();   // the mapping outlives every view into it
+    return p;
+}
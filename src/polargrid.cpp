@@ -0,0 +1,169 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "polargrid.h"
+#include "physicsengine.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iostream>
+#include <new>
+
+static constexpr size_t CACHE_LINE = 64;
+
+// ---------------------------
+// PolarAxis
+// ---------------------------
+PolarAxis::PolarAxis(std::vector<float> breakpoints)
+    : nodes(std::move(breakpoints))
+{
+    if (nodes.empty()) nodes.push_back(0.0f);
+    min_value = nodes.front();
+    max_value = nodes.back();
+    if (nodes.size() < 2) return;
+
+    const float step = (max_value - min_value) / float(nodes.size() - 1);
+    for (size_t i = 0; i + 1 < nodes.size(); ++i) {
+        if (std::fabs((nodes[i + 1] - nodes[i]) - step) > 1e-3f * step) { uniform = false; break; }
+    }
+    if (uniform && step > 0.0f) inv_step = 1.0f / step;
+}
+
+int PolarAxis::locate(float x, int32_t& hint, float& t) const
+{
+    if (nodes.size() < 2) { t = 0.0f; return 0; }
+
+    x = std::clamp(x, min_value, max_value);
+    const int last = int(nodes.size()) - 2;
+
+    int i;
+    if (uniform) {
+        i = std::min(int((x - min_value) * inv_step), last);
+    } else {
+        const int h = hint;
+        if (h >= 0 && h <= last && x >= nodes[h] && x <= nodes[h + 1]) {
+            i = h;
+        } else if (h >= 0 && h < last && x >= nodes[h + 1] && x <= nodes[h + 2]) {
+            i = h + 1;
+        } else if (h > 0 && h <= last + 1 && x >= nodes[h - 1] && x <= nodes[h]) {
+            i = h - 1;
+        } else {
+            i = int(std::upper_bound(nodes.begin(), nodes.end(), x) - nodes.begin()) - 1;
+            i = std::clamp(i, 0, last);
+        }
+    }
+
+    hint = i;
+    float w = nodes[i + 1] - nodes[i];
+    t = (w > 0.0f) ? (x - nodes[i]) / w : 0.0f;
+    return i;
+}
+
+// ---------------------------
+// PolarGrid
+// ---------------------------
+PolarGrid::PolarGrid(PolarAxis a, PolarAxis r, PolarAxis m)
+    : axes{std::move(a), std::move(r), std::move(m)}
+{
+}
+
+std::shared_ptr<const PolarGrid> PolarGrid::create(std::vector<float> alpha_deg,
+                                                   std::vector<float> reynolds,
+                                                   std::vector<float> mach,
+                                                   const std::vector<glm::vec3>& values)
+{
+    auto monotone = [](const std::vector<float>& v) {
+        for (size_t i = 0; i + 1 < v.size(); ++i)
+            if (!(v[i + 1] > v[i])) return false;
+        return true;
+    };
+    if (!monotone(alpha_deg) || !monotone(reynolds) || !monotone(mach)) {
+        std::cerr << "PolarGrid: axis breakpoints must be strictly increasing\n";
+        return nullptr;
+    }
+
+    std::shared_ptr<PolarGrid> grid(new PolarGrid(PolarAxis(std::move(alpha_deg)),
+                                                  PolarAxis(std::move(reynolds)),
+                                                  PolarAxis(std::move(mach))));
+    const size_t na = grid->axes[0].nodes.size();
+    const size_t nr = grid->axes[1].nodes.size();
+    const size_t nm = grid->axes[2].nodes.size();
+    if (values.size() != na * nr * nm) {
+        std::cerr << "PolarGrid: expected " << na * nr * nm << " values, got " << values.size() << "\n";
+        return nullptr;
+    }
+
+    // active axes, in term-bit order
+    const int* active = grid->active;
+    grid->dims = 0;
+    for (int ax = 0; ax < 3; ++ax)
+        if (grid->axes[ax].nodes.size() > 1) grid->active[grid->dims++] = ax;
+    grid->terms = 1 << grid->dims;
+
+    const int ca = grid->axes[0].cells(), cr = grid->axes[1].cells(), cm = grid->axes[2].cells();
+    const size_t cellCount = size_t(ca) * cr * cm;
+    const size_t count = cellCount * grid->terms;
+
+    glm::vec4* block = static_cast<glm::vec4*>(::operator new(count * sizeof(glm::vec4), std::align_val_t(CACHE_LINE)));
+    grid->cells = std::shared_ptr<glm::vec4>(block, [](glm::vec4* p) {
+        ::operator delete(p, std::align_val_t(CACHE_LINE));
+    });
+
+    auto node = [&](size_t ia, size_t ir, size_t im) {
+        return glm::vec4(values[(im * nr + ir) * na + ia], 0.0f);
+    };
+
+    for (int im = 0; im < cm; ++im)
+    for (int ir = 0; ir < cr; ++ir)
+    for (int ia = 0; ia < ca; ++ia) {
+        // corner values, indexed by active-axis bit pattern
+        glm::vec4 corner[8];
+        for (int j = 0; j < grid->terms; ++j) {
+            int idx[3] = {ia, ir, im};
+            for (int b = 0; b < grid->dims; ++b)
+                if (j & (1 << b)) ++idx[active[b]];
+            corner[j] = node(idx[0], idx[1], idx[2]);
+        }
+
+        // multilinear coefficients: term k = sum over subsets j of k of (-1)^(|k|-|j|) f[j]
+        glm::vec4* out = block + ((size_t(im) * cr + ir) * ca + ia) * grid->terms;
+        for (int k = 0; k < grid->terms; ++k) {
+            glm::vec4 c(0.0f);
+            for (int j = 0; j < grid->terms; ++j) {
+                if ((j & k) != j) continue;
+                int parity = std::popcount(unsigned(k ^ j)) & 1;
+                c += parity ? -corner[j] : corner[j];
+            }
+            out[k] = c;
+        }
+    }
+
+    return grid;
+}
+
+AeroCoeffs PolarGrid::sample(float alpha_deg, float reynolds, float mach, PolarCellHint* hint) const
+{
+    PolarCellHint local;
+    PolarCellHint& h = hint ? *hint : local;
+
+    float t[3];
+    const int ia = axes[0].locate(alpha_deg, h.alpha, t[0]);
+    const int ir = axes[1].locate(reynolds, h.re, t[1]);
+    const int im = axes[2].locate(mach, h.mach, t[2]);
+
+    const int ca = axes[0].cells(), cr = axes[1].cells();
+    const glm::vec4* c = cells.get() + ((size_t(im) * cr + ir) * ca + ia) * terms;
+
+    // local coordinates of the active axes, in term-bit order
+    const float u[3] = {t[active[0]], t[active[1]], t[active[2]]};
+
+    glm::vec4 r;
+    switch (dims) {
+    case 0: r = c[0]; break;
+    case 1: r = c[0] + u[0] * c[1]; break;
+    case 2: r = (c[0] + u[0] * c[1]) + u[1] * (c[2] + u[0] * c[3]); break;
+    default:
+        r = (c[0] + u[0] * c[1]) + u[1] * (c[2] + u[0] * c[3]) +
+            u[2] * ((c[4] + u[0] * c[5]) + u[1] * (c[6] + u[0] * c[7]));
+        break;
+    }
+    return { r.x, r.y, r.z, 0.0f, 0.0f };
+}
@@ -129,3 +129,18 @@ void renderFrame(GLFWwindow* window,
         glDrawArrays(GL_LINES, 0, gridYZVertexCount);
 }
 
+//
+// Render the interpolated pose between two sim steps
+//
+void renderFrame(GLFWwindow* window,
+                 GLuint planeVAO,
+                 GLuint edgeVAO,
+                 GLuint gridVAO,
+                 GLuint gridYZVAO,
+                 const SimState& prev,
+                 const SimState& curr,
+                 float alpha)
+{
+    SimState s = interpolateState(prev, curr, alpha);
+    renderFrame(window, planeVAO, edgeVAO, gridVAO, gridYZVAO, s.position, s.orientation);
+}
@@ -0,0 +1,100 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "simthread.h"
+#include <algorithm>
+
+// ---------------------------
+// States
+// ---------------------------
+SimState captureState(const Aircraft& plane, uint64_t step)
+{
+    SimState s;
+    s.position = plane.position;
+    s.orientation = plane.orientation;
+    s.velocity = plane.velocity;
+    s.lift = plane.lift;
+    s.drag = plane.drag;
+    s.thrustVec = plane.thrustVec;
+    s.step = step;
+    return s;
+}
+
+SimState interpolateState(const SimState& a, const SimState& b, float alpha)
+{
+    SimState s = b;
+    s.position = glm::mix(a.position, b.position, alpha);
+    s.orientation = glm::slerp(a.orientation, b.orientation, alpha);
+    s.velocity = glm::mix(a.velocity, b.velocity, alpha);
+    return s;
+}
+
+// ---------------------------
+// SimThread
+// ---------------------------
+SimThread::SimThread(const Aircraft& plane_, float dt_, StepHook hook_, int maxCatchUp_)
+    : plane(plane_), dt(dt_ > 0.0f ? dt_ : 1.0f / 120.0f), maxCatchUp(std::max(1, maxCatchUp_)),
+      hook(std::move(hook_))
+{
+    prevState = currState = captureState(plane, 0);
+    currDue = Clock::now();
+    thread = std::thread(&SimThread::run, this);
+}
+
+SimThread::~SimThread()
+{
+    stop();
+}
+
+void SimThread::stop()
+{
+    stopRequested.store(true, std::memory_order_release);
+    if (thread.joinable()) thread.join();
+}
+
+void SimThread::publish(Clock::time_point due)
+{
+    SimState s = captureState(plane, steps);
+    std::lock_guard<std::mutex> lock(stateMutex);
+    prevState = currState;
+    currState = s;
+    currDue = due;
+}
+
+float SimThread::latest(SimState& prev, SimState& curr) const
+{
+    std::lock_guard<std::mutex> lock(stateMutex);
+    prev = prevState;
+    curr = currState;
+    // state k is due at t_k; drawing one step late puts "now - dt" between
+    // t_(k-1) and t_k at (now - t_k) / dt
+    float alpha = std::chrono::duration<float>(Clock::now() - currDue).count() / dt;
+    return std::clamp(alpha, 0.0f, 1.0f);
+}
+
+void SimThread::run()
+{
+    const auto step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(dt));
+    Clock::time_point next;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        next = currDue + step;
+    }
+
+    while (!stopRequested.load(std::memory_order_acquire)) {
+        Clock::time_point now = Clock::now();
+        int taken = 0;
+        while (next <= now && taken < maxCatchUp) {
+            if (hook && !hook(plane)) {
+                finished.store(true, std::memory_order_release);
+                return;
+            }
+            updatePhysics(plane, 0.0f, 0.0f, dt);
+            ++steps;
+            publish(next);
+            next += step;
+            ++taken;
+        }
+        if (next <= now) next = now + step;    // too far behind: drop the backlog
+        std::this_thread::sleep_until(next);
+    }
+    finished.store(true, std::memory_order_release);
+}
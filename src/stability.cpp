@@ -0,0 +1,149 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "stability.h"
+#include <iostream>
+
+static constexpr float DEG2RAD = 3.14159265358979323846f / 180.0f;
+static constexpr int   FIELDS  = int(sizeof(StabilityCoeffs) / sizeof(float));
+
+// ---------------------------
+// StabilityTable
+// ---------------------------
+std::shared_ptr<const StabilityTable> StabilityTable::create(std::vector<float> alpha_deg,
+                                                             std::vector<float> beta_deg,
+                                                             std::vector<StabilityCoeffs> records)
+{
+    auto monotone = [](const std::vector<float>& v) {
+        if (v.empty()) return false;
+        for (size_t i = 0; i + 1 < v.size(); ++i)
+            if (!(v[i + 1] > v[i])) return false;
+        return true;
+    };
+    if (!monotone(alpha_deg) || !monotone(beta_deg)) {
+        std::cerr << "StabilityTable: axis breakpoints must be non-empty and strictly increasing\n";
+        return nullptr;
+    }
+    if (records.size() != alpha_deg.size() * beta_deg.size()) {
+        std::cerr << "StabilityTable: expected " << alpha_deg.size() * beta_deg.size()
+                  << " records, got " << records.size() << "\n";
+        return nullptr;
+    }
+
+    std::shared_ptr<StabilityTable> table(new StabilityTable(PolarAxis(std::move(alpha_deg)),
+                                                             PolarAxis(std::move(beta_deg))));
+    table->records = std::move(records);
+    return table;
+}
+
+StabilityCoeffs StabilityTable::sample(float alpha_deg, float beta_deg, PolarCellHint* hint) const
+{
+    PolarCellHint local;
+    PolarCellHint& h = hint ? *hint : local;
+
+    float ta, tb;
+    const int ia = alpha.locate(alpha_deg, h.alpha, ta);
+    const int ib = beta.locate(beta_deg, h.re, tb);
+
+    // corner records; collapsed axes reuse the same record
+    const size_t na = alpha.nodes.size();
+    const size_t da = (na > 1) ? 1 : 0;
+    const size_t db = (beta.nodes.size() > 1) ? na : 0;
+    const StabilityCoeffs* r00 = &records[size_t(ib) * na + size_t(ia)];
+    const float* c00 = reinterpret_cast<const float*>(r00);
+    const float* c10 = reinterpret_cast<const float*>(r00 + da);
+    const float* c01 = reinterpret_cast<const float*>(r00 + db);
+    const float* c11 = reinterpret_cast<const float*>(r00 + da + db);
+
+    const float w00 = (1.0f - ta) * (1.0f - tb);
+    const float w10 = ta * (1.0f - tb);
+    const float w01 = (1.0f - ta) * tb;
+    const float w11 = ta * tb;
+
+    StabilityCoeffs out;
+    float* o = reinterpret_cast<float*>(&out);
+    for (int k = 0; k < FIELDS; ++k)
+        o[k] = w00 * c00[k] + w10 * c10[k] + w01 * c01[k] + w11 * c11[k];
+    return out;
+}
+
+StabilityCoeffs StabilityTable::sample(float alpha_deg, float beta_deg, StabilityCoeffs& dAlpha, StabilityCoeffs& dBeta,
+                                       PolarCellHint* hint) const
+{
+    PolarCellHint local;
+    PolarCellHint& h = hint ? *hint : local;
+
+    float ta, tb;
+    const int ia = alpha.locate(alpha_deg, h.alpha, ta);
+    const int ib = beta.locate(beta_deg, h.re, tb);
+
+    // dt/dx inside the cell; 0 where locate clamped or the axis collapsed
+    auto slope = [](const PolarAxis& axis, int i, float x) {
+        if (axis.nodes.size() < 2 || x < axis.min_value || x > axis.max_value) return 0.0f;
+        float w = axis.nodes[i + 1] - axis.nodes[i];
+        return (w > 0.0f) ? 1.0f / w : 0.0f;
+    };
+    const float sa = slope(alpha, ia, alpha_deg);
+    const float sb = slope(beta, ib, beta_deg);
+
+    const size_t na = alpha.nodes.size();
+    const size_t da = (na > 1) ? 1 : 0;
+    const size_t db = (beta.nodes.size() > 1) ? na : 0;
+    const StabilityCoeffs* r00 = &records[size_t(ib) * na + size_t(ia)];
+    const float* c00 = reinterpret_cast<const float*>(r00);
+    const float* c10 = reinterpret_cast<const float*>(r00 + da);
+    const float* c01 = reinterpret_cast<const float*>(r00 + db);
+    const float* c11 = reinterpret_cast<const float*>(r00 + da + db);
+
+    StabilityCoeffs out;
+    float* o = reinterpret_cast<float*>(&out);
+    float* oa = reinterpret_cast<float*>(&dAlpha);
+    float* ob = reinterpret_cast<float*>(&dBeta);
+    for (int k = 0; k < FIELDS; ++k) {
+        const float lo = c00[k] + ta * (c10[k] - c00[k]);     // along alpha at beta node ib
+        const float hi = c01[k] + ta * (c11[k] - c01[k]);     // ... at ib + 1
+        o[k] = lo + tb * (hi - lo);
+        oa[k] = sa * ((c10[k] - c00[k]) * (1.0f - tb) + (c11[k] - c01[k]) * tb);
+        ob[k] = sb * (hi - lo);
+    }
+    return out;
+}
+
+// ---------------------------
+// Default table
+// ---------------------------
+std::shared_ptr<const StabilityTable> defaultStabilityTable()
+{
+    static const std::shared_ptr<const StabilityTable> table = [] {
+        // per-rad derivatives of a typical light single (Cessna 172 class)
+        const float CY_beta = -0.31f, Cl_beta = -0.089f, Cn_beta = 0.065f;
+
+        StabilityCoeffs base{};
+        base.Cl_p  = -0.47f;
+        base.Cm_q  = -12.4f;
+        base.Cn_r  = -0.099f;
+        base.Cl_r  = 0.096f;
+        base.Cn_p  = -0.03f;
+        base.CY_dr = 0.187f;
+        base.Cl_da = 0.178f;
+        base.Cn_da = -0.053f;
+        base.Cl_dr = 0.0147f;
+        base.Cn_dr = -0.0657f;
+        base.Cm_de = -1.28f;
+        base.CL_de = 0.43f;
+
+        // static terms are linear in beta, so two beta breakpoints are exact
+        std::vector<float> alpha = {-20.0f, 20.0f};
+        std::vector<float> beta = {-30.0f, 30.0f};
+        std::vector<StabilityCoeffs> records;
+        for (float b : beta) {
+            for (size_t i = 0; i < alpha.size(); ++i) {
+                StabilityCoeffs r = base;
+                r.CY = CY_beta * b * DEG2RAD;
+                r.Cl = Cl_beta * b * DEG2RAD;
+                r.Cn = Cn_beta * b * DEG2RAD;
+                records.push_back(r);
+            }
+        }
+        return StabilityTable::create(alpha, beta, records);
+    }();
+    return table;
+}
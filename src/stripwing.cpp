@@ -0,0 +1,397 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "stripwing.h"
+#include "physicsengine.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#define STRIP_SIMD_X86 1
+#else
+#define STRIP_SIMD_X86 0
+#endif
+
+#if STRIP_SIMD_X86 && defined(__GNUC__)
+#define STRIP_SIMD_AVX2 1   // built with target("avx2"), selected at runtime
+#else
+#define STRIP_SIMD_AVX2 0
+#endif
+
+static constexpr float PI_F = 3.14159265358979323846f;
+static constexpr float RAD2DEG = 180.0f / PI_F;
+static constexpr size_t LANES = 8;
+static constexpr int ENTRY = 4;     // floats per coefficient entry (Cl, Cd, Cm, 0)
+
+// atan polynomial on [0, 1] (|err| < 1e-5 rad); every kernel uses the same sequence
+static constexpr float ATAN_C1 = 0.99997726f;
+static constexpr float ATAN_C3 = -0.33262347f;
+static constexpr float ATAN_C5 = 0.19354346f;
+static constexpr float ATAN_C7 = -0.11643287f;
+static constexpr float ATAN_C9 = 0.05265332f;
+static constexpr float ATAN_C11 = -0.01172120f;
+
+// ---------------------------
+// Kernel inputs
+// ---------------------------
+namespace {
+struct StripView {
+    const float *x, *y, *z, *area, *chord, *incidence, *aileronMix, *elevatorMix;
+    const int32_t* base;
+    const float* coeffs;
+    size_t n;
+};
+
+struct StripFlight {
+    float vx, vy;           // CG velocity (body x, y)
+    float wx, wy, wz;       // body rates
+    float aileron, elevator;
+    float halfRho;
+};
+
+struct StripSums {
+    float Fx = 0.0f, Fy = 0.0f, Mx = 0.0f, My = 0.0f, Mz = 0.0f;
+};
+
+inline float atan2Approx(float y, float x)
+{
+    float ax = std::fabs(x), ay = std::fabs(y);
+    float a = std::min(ax, ay) / std::max(std::max(ax, ay), 1e-30f);
+    float s = a * a;
+    float r = (((((ATAN_C11 * s + ATAN_C9) * s + ATAN_C7) * s + ATAN_C5) * s + ATAN_C3) * s + ATAN_C1) * a;
+    if (ay > ax) r = 0.5f * PI_F - r;
+    if (x < 0.0f) r = PI_F - r;
+    return std::copysign(r, y);
+}
+} // namespace
+
+// ---------------------------
+// Scalar kernel: reference / non-x86 path
+// ---------------------------
+[[maybe_unused]] static void stripsScalar(const StripView& v, const StripFlight& f, StripSums& acc)
+{
+    for (size_t i = 0; i < v.n; ++i) {
+        // local flow: CG velocity + omega x r (spanwise component ignored)
+        float vx = f.vx + (f.wy * v.z[i] - f.wz * v.y[i]);
+        float vy = f.vy + (f.wz * v.x[i] - f.wx * v.z[i]);
+
+        float alpha = atan2Approx(-vy, vx) * RAD2DEG + v.incidence[i] +
+                      v.aileronMix[i] * f.aileron + v.elevatorMix[i] * f.elevator;
+        float u = std::clamp((alpha - AeroCoeffTable::MIN_DEG) * (1.0f / AeroCoeffTable::STEP_DEG),
+                             0.0f, float(AeroCoeffTable::SIZE - 1));
+        int k = std::min(int(u), AeroCoeffTable::SIZE - 2);
+        float t = u - float(k);
+        const float* c = v.coeffs + size_t(v.base[i] + k) * ENTRY;
+        float cl = c[0] + t * (c[ENTRY + 0] - c[0]);
+        float cd = c[1] + t * (c[ENTRY + 1] - c[1]);
+        float cm = c[2] + t * (c[ENTRY + 2] - c[2]);
+
+        float s2 = vx * vx + vy * vy;
+        float inv = 1.0f / std::sqrt(std::max(s2, 1e-12f));
+        float ux = vx * inv, uy = vy * inv;
+        float qS = f.halfRho * s2 * v.area[i];
+
+        float Fx = qS * (-cl * uy - cd * ux);
+        float Fy = qS * (cl * ux - cd * uy);
+        acc.Fx += Fx;
+        acc.Fy += Fy;
+        acc.Mx += -v.z[i] * Fy;
+        acc.My += v.z[i] * Fx;
+        acc.Mz += (v.x[i] * Fy - v.y[i] * Fx) + cm * qS * v.chord[i];
+    }
+}
+
+// ---------------------------
+// AVX2: 8 strips per iteration, gathered table entries
+// ---------------------------
+#if STRIP_SIMD_AVX2
+__attribute__((target("avx2,fma")))
+static float hsum256(__m256 v)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+    return _mm_cvtss_f32(s);
+}
+
+__attribute__((target("avx2,fma")))
+static void stripsAVX2(const StripView& v, const StripFlight& f, StripSums& acc)
+{
+    const __m256 Vx = _mm256_set1_ps(f.vx), Vy = _mm256_set1_ps(f.vy);
+    const __m256 wx = _mm256_set1_ps(f.wx), wy = _mm256_set1_ps(f.wy), wz = _mm256_set1_ps(f.wz);
+    const __m256 ail = _mm256_set1_ps(f.aileron), elev = _mm256_set1_ps(f.elevator);
+    const __m256 halfRho = _mm256_set1_ps(f.halfRho);
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+    const __m256 tiny = _mm256_set1_ps(1e-30f), eps = _mm256_set1_ps(1e-12f);
+    const __m256 halfPi = _mm256_set1_ps(0.5f * PI_F), pi = _mm256_set1_ps(PI_F);
+    const __m256 c1 = _mm256_set1_ps(ATAN_C1), c3 = _mm256_set1_ps(ATAN_C3), c5 = _mm256_set1_ps(ATAN_C5);
+    const __m256 c7 = _mm256_set1_ps(ATAN_C7), c9 = _mm256_set1_ps(ATAN_C9), c11 = _mm256_set1_ps(ATAN_C11);
+    const __m256 rad2deg = _mm256_set1_ps(RAD2DEG);
+    const __m256 minDeg = _mm256_set1_ps(AeroCoeffTable::MIN_DEG);
+    const __m256 invStep = _mm256_set1_ps(1.0f / AeroCoeffTable::STEP_DEG);
+    const __m256 maxU = _mm256_set1_ps(float(AeroCoeffTable::SIZE - 1));
+    const __m256i lastK = _mm256_set1_epi32(AeroCoeffTable::SIZE - 2);
+
+    __m256 sFx = zero, sFy = zero, sMx = zero, sMy = zero, sMz = zero;
+    for (size_t i = 0; i < v.n; i += LANES) {
+        const __m256 x = _mm256_loadu_ps(v.x + i), y = _mm256_loadu_ps(v.y + i), z = _mm256_loadu_ps(v.z + i);
+
+        __m256 vx = _mm256_add_ps(Vx, _mm256_sub_ps(_mm256_mul_ps(wy, z), _mm256_mul_ps(wz, y)));
+        __m256 vy = _mm256_add_ps(Vy, _mm256_sub_ps(_mm256_mul_ps(wz, x), _mm256_mul_ps(wx, z)));
+
+        // atan2(-vy, vx)
+        __m256 ny = _mm256_xor_ps(vy, signMask);
+        __m256 ax = _mm256_andnot_ps(signMask, vx), ay = _mm256_andnot_ps(signMask, ny);
+        __m256 a = _mm256_div_ps(_mm256_min_ps(ax, ay), _mm256_max_ps(_mm256_max_ps(ax, ay), tiny));
+        __m256 s = _mm256_mul_ps(a, a);
+        __m256 poly = _mm256_add_ps(_mm256_mul_ps(c11, s), c9);
+        poly = _mm256_add_ps(_mm256_mul_ps(poly, s), c7);
+        poly = _mm256_add_ps(_mm256_mul_ps(poly, s), c5);
+        poly = _mm256_add_ps(_mm256_mul_ps(poly, s), c3);
+        __m256 r = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(poly, s), c1), a);
+        r = _mm256_blendv_ps(r, _mm256_sub_ps(halfPi, r), _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+        r = _mm256_blendv_ps(r, _mm256_sub_ps(pi, r), _mm256_cmp_ps(vx, zero, _CMP_LT_OQ));
+        r = _mm256_or_ps(r, _mm256_and_ps(ny, signMask));
+
+        __m256 alpha = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(r, rad2deg), _mm256_loadu_ps(v.incidence + i)),
+                                     _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(v.aileronMix + i), ail),
+                                                   _mm256_mul_ps(_mm256_loadu_ps(v.elevatorMix + i), elev)));
+
+        // quarter-degree table, linear between entries
+        __m256 u = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(alpha, minDeg), invStep), zero), maxU);
+        __m256i k = _mm256_min_epi32(_mm256_cvttps_epi32(u), lastK);
+        __m256 t = _mm256_sub_ps(u, _mm256_cvtepi32_ps(k));
+        __m256i e = _mm256_slli_epi32(_mm256_add_epi32(k, _mm256_loadu_si256((const __m256i*)(v.base + i))), 2);
+        __m256 cl0 = _mm256_i32gather_ps(v.coeffs + 0, e, 4), cl1 = _mm256_i32gather_ps(v.coeffs + ENTRY + 0, e, 4);
+        __m256 cd0 = _mm256_i32gather_ps(v.coeffs + 1, e, 4), cd1 = _mm256_i32gather_ps(v.coeffs + ENTRY + 1, e, 4);
+        __m256 cm0 = _mm256_i32gather_ps(v.coeffs + 2, e, 4), cm1 = _mm256_i32gather_ps(v.coeffs + ENTRY + 2, e, 4);
+        __m256 cl = _mm256_add_ps(cl0, _mm256_mul_ps(t, _mm256_sub_ps(cl1, cl0)));
+        __m256 cd = _mm256_add_ps(cd0, _mm256_mul_ps(t, _mm256_sub_ps(cd1, cd0)));
+        __m256 cm = _mm256_add_ps(cm0, _mm256_mul_ps(t, _mm256_sub_ps(cm1, cm0)));
+
+        __m256 s2 = _mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy));
+        __m256 inv = _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_max_ps(s2, eps)));
+        __m256 ux = _mm256_mul_ps(vx, inv), uy = _mm256_mul_ps(vy, inv);
+        __m256 qS = _mm256_mul_ps(_mm256_mul_ps(halfRho, s2), _mm256_loadu_ps(v.area + i));
+
+        __m256 Fx = _mm256_mul_ps(qS, _mm256_sub_ps(_mm256_xor_ps(_mm256_mul_ps(cl, uy), signMask), _mm256_mul_ps(cd, ux)));
+        __m256 Fy = _mm256_mul_ps(qS, _mm256_sub_ps(_mm256_mul_ps(cl, ux), _mm256_mul_ps(cd, uy)));
+        sFx = _mm256_add_ps(sFx, Fx);
+        sFy = _mm256_add_ps(sFy, Fy);
+        sMx = _mm256_sub_ps(sMx, _mm256_mul_ps(z, Fy));
+        sMy = _mm256_add_ps(sMy, _mm256_mul_ps(z, Fx));
+        sMz = _mm256_add_ps(sMz, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(x, Fy), _mm256_mul_ps(y, Fx)),
+                                               _mm256_mul_ps(_mm256_mul_ps(cm, qS), _mm256_loadu_ps(v.chord + i))));
+    }
+    acc.Fx += hsum256(sFx);
+    acc.Fy += hsum256(sFy);
+    acc.Mx += hsum256(sMx);
+    acc.My += hsum256(sMy);
+    acc.Mz += hsum256(sMz);
+}
+
+static bool cpuHasAVX2()
+{
+    static const bool has = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return has;
+}
+#endif
+
+// ---------------------------
+// SSE: 4 strips per iteration, scalar table fetch (no gathers)
+// ---------------------------
+#if STRIP_SIMD_X86
+static inline __m128 selectSSE(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, a));
+}
+
+static float hsum128(__m128 s)
+{
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+    return _mm_cvtss_f32(s);
+}
+
+static void stripsSSE(const StripView& v, const StripFlight& f, StripSums& acc)
+{
+    const __m128 Vx = _mm_set1_ps(f.vx), Vy = _mm_set1_ps(f.vy);
+    const __m128 wx = _mm_set1_ps(f.wx), wy = _mm_set1_ps(f.wy), wz = _mm_set1_ps(f.wz);
+    const __m128 ail = _mm_set1_ps(f.aileron), elev = _mm_set1_ps(f.elevator);
+    const __m128 halfRho = _mm_set1_ps(f.halfRho);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+    const __m128 tiny = _mm_set1_ps(1e-30f), eps = _mm_set1_ps(1e-12f);
+    const __m128 halfPi = _mm_set1_ps(0.5f * PI_F), pi = _mm_set1_ps(PI_F);
+    const __m128 c1 = _mm_set1_ps(ATAN_C1), c3 = _mm_set1_ps(ATAN_C3), c5 = _mm_set1_ps(ATAN_C5);
+    const __m128 c7 = _mm_set1_ps(ATAN_C7), c9 = _mm_set1_ps(ATAN_C9), c11 = _mm_set1_ps(ATAN_C11);
+    const __m128 rad2deg = _mm_set1_ps(RAD2DEG);
+    const __m128 minDeg = _mm_set1_ps(AeroCoeffTable::MIN_DEG);
+    const __m128 invStep = _mm_set1_ps(1.0f / AeroCoeffTable::STEP_DEG);
+    const __m128 maxU = _mm_set1_ps(float(AeroCoeffTable::SIZE - 1));
+
+    __m128 sFx = zero, sFy = zero, sMx = zero, sMy = zero, sMz = zero;
+    for (size_t i = 0; i < v.n; i += 4) {
+        const __m128 x = _mm_loadu_ps(v.x + i), y = _mm_loadu_ps(v.y + i), z = _mm_loadu_ps(v.z + i);
+
+        __m128 vx = _mm_add_ps(Vx, _mm_sub_ps(_mm_mul_ps(wy, z), _mm_mul_ps(wz, y)));
+        __m128 vy = _mm_add_ps(Vy, _mm_sub_ps(_mm_mul_ps(wz, x), _mm_mul_ps(wx, z)));
+
+        __m128 ny = _mm_xor_ps(vy, signMask);
+        __m128 ax = _mm_andnot_ps(signMask, vx), ay = _mm_andnot_ps(signMask, ny);
+        __m128 a = _mm_div_ps(_mm_min_ps(ax, ay), _mm_max_ps(_mm_max_ps(ax, ay), tiny));
+        __m128 s = _mm_mul_ps(a, a);
+        __m128 poly = _mm_add_ps(_mm_mul_ps(c11, s), c9);
+        poly = _mm_add_ps(_mm_mul_ps(poly, s), c7);
+        poly = _mm_add_ps(_mm_mul_ps(poly, s), c5);
+        poly = _mm_add_ps(_mm_mul_ps(poly, s), c3);
+        __m128 r = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(poly, s), c1), a);
+        r = selectSSE(_mm_cmpgt_ps(ay, ax), r, _mm_sub_ps(halfPi, r));
+        r = selectSSE(_mm_cmplt_ps(vx, zero), r, _mm_sub_ps(pi, r));
+        r = _mm_or_ps(r, _mm_and_ps(ny, signMask));
+
+        __m128 alpha = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, rad2deg), _mm_loadu_ps(v.incidence + i)),
+                                  _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(v.aileronMix + i), ail),
+                                             _mm_mul_ps(_mm_loadu_ps(v.elevatorMix + i), elev)));
+
+        __m128 u = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(alpha, minDeg), invStep), zero), maxU);
+        alignas(16) int k[4];
+        _mm_store_si128((__m128i*)k, _mm_cvttps_epi32(u));
+        for (int j = 0; j < 4; ++j) k[j] = std::min(k[j], AeroCoeffTable::SIZE - 2);
+        __m128 t = _mm_sub_ps(u, _mm_cvtepi32_ps(_mm_load_si128((const __m128i*)k)));
+
+        // transpose the four (Cl, Cd, Cm, 0) entries and their successors
+        const float* e0 = v.coeffs + size_t(v.base[i + 0] + k[0]) * ENTRY;
+        const float* e1 = v.coeffs + size_t(v.base[i + 1] + k[1]) * ENTRY;
+        const float* e2 = v.coeffs + size_t(v.base[i + 2] + k[2]) * ENTRY;
+        const float* e3 = v.coeffs + size_t(v.base[i + 3] + k[3]) * ENTRY;
+        __m128 lo0 = _mm_loadu_ps(e0), lo1 = _mm_loadu_ps(e1), lo2 = _mm_loadu_ps(e2), lo3 = _mm_loadu_ps(e3);
+        __m128 hi0 = _mm_loadu_ps(e0 + ENTRY), hi1 = _mm_loadu_ps(e1 + ENTRY);
+        __m128 hi2 = _mm_loadu_ps(e2 + ENTRY), hi3 = _mm_loadu_ps(e3 + ENTRY);
+        _MM_TRANSPOSE4_PS(lo0, lo1, lo2, lo3); // Cl, Cd, Cm, 0
+        _MM_TRANSPOSE4_PS(hi0, hi1, hi2, hi3);
+        __m128 cl = _mm_add_ps(lo0, _mm_mul_ps(t, _mm_sub_ps(hi0, lo0)));
+        __m128 cd = _mm_add_ps(lo1, _mm_mul_ps(t, _mm_sub_ps(hi1, lo1)));
+        __m128 cm = _mm_add_ps(lo2, _mm_mul_ps(t, _mm_sub_ps(hi2, lo2)));
+
+        __m128 s2 = _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy));
+        __m128 inv = _mm_div_ps(one, _mm_sqrt_ps(_mm_max_ps(s2, eps)));
+        __m128 ux = _mm_mul_ps(vx, inv), uy = _mm_mul_ps(vy, inv);
+        __m128 qS = _mm_mul_ps(_mm_mul_ps(halfRho, s2), _mm_loadu_ps(v.area + i));
+
+        __m128 Fx = _mm_mul_ps(qS, _mm_sub_ps(_mm_xor_ps(_mm_mul_ps(cl, uy), signMask), _mm_mul_ps(cd, ux)));
+        __m128 Fy = _mm_mul_ps(qS, _mm_sub_ps(_mm_mul_ps(cl, ux), _mm_mul_ps(cd, uy)));
+        sFx = _mm_add_ps(sFx, Fx);
+        sFy = _mm_add_ps(sFy, Fy);
+        sMx = _mm_sub_ps(sMx, _mm_mul_ps(z, Fy));
+        sMy = _mm_add_ps(sMy, _mm_mul_ps(z, Fx));
+        sMz = _mm_add_ps(sMz, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(x, Fy), _mm_mul_ps(y, Fx)),
+                                         _mm_mul_ps(_mm_mul_ps(cm, qS), _mm_loadu_ps(v.chord + i))));
+    }
+    acc.Fx += hsum128(sFx);
+    acc.Fy += hsum128(sFy);
+    acc.Mx += hsum128(sMx);
+    acc.My += hsum128(sMy);
+    acc.Mz += hsum128(sMz);
+}
+#endif
+
+// ---------------------------
+// StripWing
+// ---------------------------
+std::shared_ptr<const StripWing> StripWing::create(const std::vector<StripSurface>& surfaces,
+                                                   const AirfoilProperties& props)
+{
+    size_t total = 0;
+    for (const StripSurface& s : surfaces) {
+        if (s.strips < 1 || !(s.span > 0.0f) || !(s.rootChord > 0.0f) || !(s.tipChord > 0.0f)) {
+            std::cerr << "StripWing: surfaces need at least one strip and positive span/chords\n";
+            return nullptr;
+        }
+        total += size_t(s.strips);
+    }
+    if (total == 0) {
+        std::cerr << "StripWing: no surfaces\n";
+        return nullptr;
+    }
+
+    std::shared_ptr<StripWing> wing(new StripWing());
+    wing->count = total;
+    wing->padded = (total + LANES - 1) / LANES * LANES;
+    for (auto* v : {&wing->x, &wing->y, &wing->z, &wing->area, &wing->chord,
+                    &wing->incidence, &wing->aileronMix, &wing->elevatorMix})
+        v->assign(wing->padded, 0.0f);   // padding strips have zero area: no load
+    wing->base.assign(wing->padded, 0);
+    wing->coeffs.resize(surfaces.size() * AeroCoeffTable::SIZE * ENTRY);
+
+    size_t i = 0;
+    for (size_t si = 0; si < surfaces.size(); ++si) {
+        const StripSurface& s = surfaces[si];
+        const float half = 0.5f * s.span;
+        const float dz = s.span / float(s.strips);
+        const float planform = 0.5f * (s.rootChord + s.tipChord) * s.span;
+        const int32_t tableBase = int32_t(si * AeroCoeffTable::SIZE);
+
+        for (int k = 0; k < s.strips; ++k, ++i) {
+            const float zk = -half + (float(k) + 0.5f) * dz;
+            const float c = s.rootChord + (s.tipChord - s.rootChord) * (std::fabs(zk) / half);
+            wing->x[i] = s.root.x;
+            wing->y[i] = s.root.y;
+            wing->z[i] = s.root.z + zk;
+            wing->chord[i] = c;
+            wing->area[i] = c * dz;
+            wing->incidence[i] = s.incidenceDeg;
+            // positive aileron raises the right (+z) wing's incidence
+            if (s.aileron > 0.0f && std::fabs(zk) >= (1.0f - s.aileron) * half)
+                wing->aileronMix[i] = (zk > 0.0f ? 1.0f : -1.0f) * RAD2DEG;
+            wing->elevatorMix[i] = s.elevator * RAD2DEG;
+            wing->base[i] = tableBase;
+        }
+
+        // section data: the paper model for this surface's aspect ratio
+        auto table = acquireAeroCoeffTable(s.span * s.span / planform, props);
+        float* dst = wing->coeffs.data() + size_t(tableBase) * ENTRY;
+        for (int e = 0; e < AeroCoeffTable::SIZE; ++e) {
+            dst[e * ENTRY + 0] = table->entries[e].Cl;
+            dst[e * ENTRY + 1] = table->entries[e].Cd;
+            dst[e * ENTRY + 2] = table->entries[e].Cm;
+            dst[e * ENTRY + 3] = 0.0f;
+        }
+    }
+    return wing;
+}
+
+StripLoads StripWing::evaluate(const glm::vec3& velBody, const glm::vec3& omega, const glm::vec3& controls,
+                               float rho) const
+{
+    StripView v{x.data(), y.data(), z.data(), area.data(), chord.data(), incidence.data(),
+                aileronMix.data(), elevatorMix.data(), base.data(), coeffs.data(), padded};
+    StripFlight f{velBody.x, velBody.y, omega.x, omega.y, omega.z, controls.x, controls.y, 0.5f * rho};
+    StripSums acc;
+
+#if STRIP_SIMD_AVX2
+    if (cpuHasAVX2()) stripsAVX2(v, f, acc);
+    else
+#endif
+#if STRIP_SIMD_X86
+    stripsSSE(v, f, acc);
+#else
+    stripsScalar(v, f, acc);
+#endif
+
+    StripLoads out;
+    out.force = glm::vec3(acc.Fx, acc.Fy, 0.0f);
+    out.moment = glm::vec3(acc.Mx, acc.My, acc.Mz);
+    return out;
+}
+
+std::shared_ptr<const StripWing> defaultStripWing(const Aircraft& plane, int strips)
+{
+    StripSurface wing;
+    wing.span = plane.wingspan;
+    wing.rootChord = wing.tipChord = plane.wingArea / plane.wingspan;
+    wing.strips = strips;
+    wing.aileron = 0.3f;
+    return StripWing::create({wing}, plane.airfoil.properties());
+}
@@ -0,0 +1,276 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "sweep.h"
+#include "threadpool.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+static constexpr float PI_F = 3.14159265358979323846f;
+
+// ---------------------------
+// Cases
+// ---------------------------
+const char* sweepVarName(SweepVar v)
+{
+    static const char* const names[SWEEP_VAR_COUNT] = {
+        "mass", "wingArea", "wingspan", "chord", "thrust", "Ixx", "Iyy", "Izz",
+        "altitude", "speed", "pitch", "yaw", "roll", "rollRate", "pitchRate", "yawRate",
+    };
+    return v < SWEEP_VAR_COUNT ? names[v] : "?";
+}
+
+SweepCase defaultSweepCase()
+{
+    SweepCase c{};
+    c[SWEEP_MASS] = 2.0f;
+    c[SWEEP_WING_AREA] = 0.4046f;
+    c[SWEEP_WINGSPAN] = 2.0f;
+    c[SWEEP_CHORD] = 0.1524f;
+    c[SWEEP_THRUST] = 0.0f;
+    c[SWEEP_IXX] = c[SWEEP_IYY] = c[SWEEP_IZZ] = 0.05f;
+    c[SWEEP_ALTITUDE] = 30.0f;
+    c[SWEEP_SPEED] = 10.0f;
+    return c;
+}
+
+uint64_t sweepCaseCount(const SweepSpec& spec)
+{
+    if (spec.samples == 0 || !(spec.dt > 0.0f) || !(spec.duration >= 0.0f)) {
+        std::cerr << "sweep: samples and dt must be positive, duration non-negative\n";
+        return 0;
+    }
+    bool seen[SWEEP_VAR_COUNT] = {};
+    uint64_t n = spec.samples;
+    for (const SweepParam& p : spec.params) {
+        if (p.var >= SWEEP_VAR_COUNT || seen[p.var]) {
+            std::cerr << "sweep: parameter " << sweepVarName(p.var) << " is unknown or repeated\n";
+            return 0;
+        }
+        seen[p.var] = true;
+        if (p.dist != SweepDist::Grid) continue;
+        if (p.count == 0) {
+            std::cerr << "sweep: grid over " << sweepVarName(p.var) << " has no points\n";
+            return 0;
+        }
+        if (n > std::numeric_limits<uint64_t>::max() / p.count) {
+            std::cerr << "sweep: case count overflows\n";
+            return 0;
+        }
+        n *= p.count;
+    }
+    return n;
+}
+
+// splitmix64 finalizer: a well-mixed 64-bit value per (seed, case, slot)
+static uint64_t mix(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// uniform in (0, 1)
+static float unitDraw(uint64_t seed, uint64_t index, uint32_t slot)
+{
+    uint64_t h = mix(seed ^ mix(index ^ (uint64_t(slot) << 56)));
+    return (float(h >> 40) + 0.5f) * (1.0f / 16777216.0f);
+}
+
+SweepCase sweepCase(const SweepSpec& spec, uint64_t index)
+{
+    SweepCase c = spec.base;
+
+    // grid coordinates: last grid parameter varies fastest, samples faster still
+    uint64_t g = index / spec.samples;
+    for (size_t k = spec.params.size(); k-- > 0;) {
+        const SweepParam& p = spec.params[k];
+        if (p.dist != SweepDist::Grid) continue;
+        uint32_t i = uint32_t(g % p.count);
+        g /= p.count;
+        c[p.var] = (p.count > 1) ? p.a + (p.b - p.a) * float(i) / float(p.count - 1) : p.a;
+    }
+
+    for (const SweepParam& p : spec.params) {
+        if (p.dist == SweepDist::Uniform) {
+            c[p.var] = p.a + (p.b - p.a) * unitDraw(spec.seed, index, 2 * p.var);
+        } else if (p.dist == SweepDist::Normal) {
+            // Box-Muller
+            float u1 = unitDraw(spec.seed, index, 2 * p.var);
+            float u2 = unitDraw(spec.seed, index, 2 * p.var + 1);
+            c[p.var] = p.a + p.b * std::sqrt(-2.0f * std::log(u1)) * std::cos(2.0f * PI_F * u2);
+        }
+    }
+    return c;
+}
+
+Aircraft sweepAircraft(const Airfoil& foil, const SweepCase& c, bool sharedAeroTable)
+{
+    Aircraft plane = createAirplane(foil,
+                                    glm::vec3(0.0f, c[SWEEP_ALTITUDE], 0.0f),
+                                    glm::vec3(c[SWEEP_PITCH], c[SWEEP_YAW], c[SWEEP_ROLL]),
+                                    c[SWEEP_MASS], c[SWEEP_WING_AREA], c[SWEEP_WINGSPAN], c[SWEEP_CHORD],
+                                    c[SWEEP_THRUST],
+                                    glm::vec3(c[SWEEP_IXX], c[SWEEP_IYY], c[SWEEP_IZZ]), sharedAeroTable);
+    plane.velocity = glm::vec3(c[SWEEP_SPEED], 0.0f, 0.0f);
+    plane.angularVelocity = glm::vec3(c[SWEEP_ROLL_RATE], c[SWEEP_PITCH_RATE], c[SWEEP_YAW_RATE]);
+    return plane;
+}
+
+// ---------------------------
+// Running a case
+// ---------------------------
+static SweepRecord flyCase(Aircraft& plane, const SweepSpec& spec, uint64_t index)
+{
+    SweepRecord r{};
+    r.caseIndex = index;
+    r.minAltitude = plane.position.y;
+    r.maxRate = glm::length(plane.angularVelocity);
+    r.outcome = SWEEP_COMPLETED;
+
+    const long steps = long(double(spec.duration) / double(spec.dt) + 0.5);
+    long s = 0;
+    while (s < steps) {
+        // the summary needs none of the per-step diagnostics
+        updatePhysics<NO_DIAGNOSTICS_PHYSICS>(plane, spec.dt);
+        ++s;
+
+        float rate = glm::length(plane.angularVelocity);
+        r.minAltitude = std::min(r.minAltitude, plane.position.y);
+        r.maxRate = std::max(r.maxRate, rate);
+        if (!std::isfinite(plane.position.y) || !std::isfinite(rate) || rate > spec.rateLimit) {
+            r.outcome = SWEEP_DIVERGED;
+            break;
+        }
+        if (plane.position.y < spec.floor) {
+            r.outcome = SWEEP_HIT_FLOOR;
+            break;
+        }
+    }
+    r.endTime = float(double(s) * double(spec.dt));
+    r.finalAltitude = plane.position.y;
+    r.finalSpeed = glm::length(plane.velocity);
+    return r;
+}
+
+SweepRecord runSweepCase(const Airfoil& foil, const SweepSpec& spec, uint64_t index)
+{
+    Aircraft plane = sweepAircraft(foil, sweepCase(spec, index));
+    return flyCase(plane, spec, index);
+}
+
+// ---------------------------
+// Results file
+// ---------------------------
+static SweepFileHeader makeHeader(const SweepSpec& spec, uint64_t caseCount)
+{
+    SweepFileHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, SWEEP_MAGIC, sizeof(h.magic));
+    h.version = SWEEP_VERSION;
+    h.paramCount = uint32_t(spec.params.size());
+    h.caseCount = caseCount;
+    h.samples = spec.samples;
+    h.seed = spec.seed;
+    h.duration = spec.duration;
+    h.dt = spec.dt;
+    h.floor = spec.floor;
+    h.rateLimit = spec.rateLimit;
+    for (size_t v = 0; v < SWEEP_VAR_COUNT; ++v) h.base[v] = spec.base[v];
+    for (size_t k = 0; k < spec.params.size(); ++k) {
+        const SweepParam& p = spec.params[k];
+        h.params[k] = {uint32_t(p.var), uint32_t(p.dist), p.a, p.b, p.count, 0u};
+    }
+    return h;
+}
+
+bool runSweep(ThreadPool& pool, const Airfoil& foil, const SweepSpec& spec, const std::string& path, size_t block)
+{
+    const uint64_t total = sweepCaseCount(spec);
+    if (total == 0) return false;
+    if (block == 0) block = 1;
+
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) { std::cerr << "runSweep: cannot open " << path << "\n"; return false; }
+
+    SweepFileHeader header = makeHeader(spec, total);
+    bool ok = std::fwrite(&header, sizeof(header), 1, f) == 1;
+
+    // one slot per participant keeps its last coefficient table alive, so
+    // consecutive cases with the same wing reuse it instead of rebuilding.
+    // A drawn wing area or span gives nearly every case its own aspect
+    // ratio: those tables are built privately in the slot rather than
+    // through the shared cache, which would only take its lock for a table
+    // no other case will ask for.
+    bool drawnWing = false;
+    for (const SweepParam& p : spec.params)
+        drawnWing |= p.dist != SweepDist::Grid && (p.var == SWEEP_WING_AREA || p.var == SWEEP_WINGSPAN);
+    std::vector<std::shared_ptr<const AeroCoeffTable>> keep(pool.size());
+    std::vector<SweepRecord> records;
+    for (uint64_t first = 0; ok && first < total; first += block) {
+        const size_t n = size_t(std::min<uint64_t>(block, total - first));
+        records.resize(n);
+        pool.parallelFor(n, 64, [&](size_t begin, size_t end, unsigned who) {
+            for (size_t i = begin; i < end; ++i) {
+                Aircraft plane = sweepAircraft(foil, sweepCase(spec, first + i), !drawnWing);
+                if (drawnWing) {
+                    const float AR = aspectRatio(plane);
+                    const AirfoilProperties& props = plane.airfoil.properties();
+                    if (!keep[who] || !keep[who]->matches(AR, props))
+                        keep[who] = std::make_shared<const AeroCoeffTable>(AR, props);
+                    plane.aeroTable = keep[who];
+                } else {
+                    keep[who] = plane.aeroTable;
+                }
+                records[i] = flyCase(plane, spec, first + i);
+            }
+        });
+        ok = std::fwrite(records.data(), sizeof(SweepRecord), n, f) == n;
+    }
+
+    ok = (std::fclose(f) == 0) && ok;
+    if (!ok) std::cerr << "runSweep: write to " << path << " failed\n";
+    return ok;
+}
+
+bool readSweepResults(const std::string& path, SweepSpec& spec, std::vector<SweepRecord>& records)
+{
+    FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) { std::cerr << "readSweepResults: cannot open " << path << "\n"; return false; }
+
+    SweepFileHeader h;
+    if (std::fread(&h, sizeof(h), 1, f) != 1 || std::memcmp(h.magic, SWEEP_MAGIC, sizeof(h.magic)) != 0 ||
+        h.version != SWEEP_VERSION || h.paramCount > SWEEP_VAR_COUNT) {
+        std::cerr << "readSweepResults: " << path << " is not a sweep results file\n";
+        std::fclose(f);
+        return false;
+    }
+
+    spec = SweepSpec();
+    spec.samples = h.samples;
+    spec.seed = h.seed;
+    spec.duration = h.duration;
+    spec.dt = h.dt;
+    spec.floor = h.floor;
+    spec.rateLimit = h.rateLimit;
+    for (size_t v = 0; v < SWEEP_VAR_COUNT; ++v) spec.base[v] = h.base[v];
+    for (uint32_t k = 0; k < h.paramCount; ++k) {
+        const SweepFileParam& p = h.params[k];
+        if (p.var >= SWEEP_VAR_COUNT || p.dist > uint32_t(SweepDist::Normal)) {
+            std::cerr << "readSweepResults: " << path << " has an unknown sweep parameter\n";
+            std::fclose(f);
+            return false;
+        }
+        spec.params.push_back({SweepVar(p.var), SweepDist(p.dist), p.a, p.b, p.count});
+    }
+
+    records.clear();
+    SweepRecord chunk[1024];
+    size_t got;
+    while ((got = std::fread(chunk, sizeof(SweepRecord), 1024, f)) > 0 && records.size() < h.caseCount)
+        records.insert(records.end(), chunk, chunk + std::min<uint64_t>(got, h.caseCount - records.size()));
+    std::fclose(f);
+    return true;
+}
@@ -0,0 +1,154 @@
+#include "threadpool.h"
+#include <algorithm>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+static uint64_t packRun(uint64_t lo, uint64_t hi) { return (hi << 32) | lo; }
+static uint32_t runLo(uint64_t r) { return uint32_t(r); }
+static uint32_t runHi(uint64_t r) { return uint32_t(r >> 32); }
+
+// ---------------------------
+// Construction
+// ---------------------------
+ThreadPool::ThreadPool(const ThreadPoolOptions& opts) : options(opts)
+{
+    unsigned n = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    runs.reset(new Run[n]);
+    workers.reserve(n - 1);
+    for (unsigned who = 1; who < n; ++who) workers.emplace_back(&ThreadPool::workerMain, this, who);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& t : workers) t.join();
+}
+
+// the calling thread (participant 0) is never pinned by the pool
+void ThreadPool::pinCurrentThread(unsigned who) const
+{
+    const unsigned cpu = options.firstCpu + who;
+#ifdef _WIN32
+    if (cpu >= 64 || !SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu))
+        std::cerr << "ThreadPool: could not pin worker " << who << " to CPU " << cpu << "\n";
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        std::cerr << "ThreadPool: could not pin worker " << who << " to CPU " << cpu << "\n";
+#else
+    std::cerr << "ThreadPool: pinning is not supported on this platform (worker " << who << ")\n";
+#endif
+}
+
+// ---------------------------
+// Scheduling
+// ---------------------------
+void ThreadPool::workerMain(unsigned who)
+{
+    if (options.pin) pinCurrentThread(who);
+
+    uint64_t seen = 0;
+    for (;;) {
+        Job* current;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            current = job;
+            if (!current) continue;     // woke after the job was already retired
+            ++busy;
+        }
+        participate(*current, who);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--busy == 0) idle.notify_one();
+        }
+    }
+}
+
+void ThreadPool::participate(Job& j, unsigned who)
+{
+    const unsigned count = size();
+    Run& own = runs[who];
+
+    for (;;) {
+        // own run, front to back
+        uint64_t r = own.range.load(std::memory_order_acquire);
+        while (runLo(r) < runHi(r)) {
+            if (!own.range.compare_exchange_weak(r, packRun(runLo(r) + 1, runHi(r)),
+                                                 std::memory_order_acq_rel, std::memory_order_acquire))
+                continue;
+            size_t begin = size_t(runLo(r)) * j.chunk;
+            j.fn(j.ctx, begin, std::min(j.n, begin + j.chunk), who);
+            j.remaining.fetch_sub(1, std::memory_order_release);
+            r = own.range.load(std::memory_order_acquire);
+        }
+
+        // out of work: take the back half of the next non-empty run
+        bool stole = false;
+        for (unsigned k = 1; k < count && !stole; ++k) {
+            Run& victim = runs[(who + k) % count];
+            uint64_t v = victim.range.load(std::memory_order_acquire);
+            while (runLo(v) < runHi(v)) {
+                uint32_t mid = runHi(v) - (runHi(v) - runLo(v) + 1) / 2;
+                if (victim.range.compare_exchange_weak(v, packRun(runLo(v), mid),
+                                                       std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    // own run is empty, so no thief can be racing on it
+                    own.range.store(packRun(mid, runHi(v)), std::memory_order_release);
+                    stole = true;
+                    break;
+                }
+            }
+        }
+        if (!stole) return;
+    }
+}
+
+void ThreadPool::run(size_t n, size_t chunk, ChunkFn fn, void* ctx)
+{
+    if (n == 0) return;
+    if (chunk == 0) chunk = 1;
+    size_t chunks = (n + chunk - 1) / chunk;
+    if (chunks > UINT32_MAX) {
+        // run indices are 32-bit; only reachable with absurdly small chunks
+        chunk = (n + UINT32_MAX - 1) / UINT32_MAX;
+        chunks = (n + chunk - 1) / chunk;
+    }
+
+    const unsigned count = size();
+    if (count == 1 || chunks == 1) {
+        for (size_t begin = 0; begin < n; begin += chunk) fn(ctx, begin, std::min(n, begin + chunk), 0);
+        return;
+    }
+
+    Job j{fn, ctx, n, chunk, {chunks}};
+    for (unsigned p = 0; p < count; ++p)
+        runs[p].range.store(packRun(chunks * p / count, chunks * (p + 1) / count), std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &j;
+        ++generation;
+    }
+    wake.notify_all();
+
+    participate(j, 0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [&] { return busy == 0 && j.remaining.load(std::memory_order_acquire) == 0; });
+    job = nullptr;
+}
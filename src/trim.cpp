@@ -0,0 +1,364 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "trim.h"
+#include "threadpool.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+static constexpr float DEG2RAD = 3.14159265358979323846f / 180.0f;
+static constexpr float GRAVITY = 9.81f;
+
+// unknowns: alpha, bank (deg), thrust, aileron, elevator, rudder (rad);
+// residual rows: body acceleration (3), angular acceleration (3)
+static constexpr int TRIM_UNKNOWNS = 6;
+
+// ---------------------------
+// Flight state for a condition and a set of unknowns
+// ---------------------------
+static void setTrimState(Aircraft& plane, const TrimCondition& c, const float* x)
+{
+    const glm::vec3 up(0.0f, 1.0f, 0.0f);
+    glm::quat path = glm::angleAxis(c.climbDeg * DEG2RAD, glm::vec3(0.0f, 0.0f, 1.0f));
+    glm::quat q = path * glm::angleAxis(x[1] * DEG2RAD, glm::vec3(1.0f, 0.0f, 0.0f))
+                       * glm::angleAxis(c.sideslipDeg * DEG2RAD, up)
+                       * glm::angleAxis(-x[0] * DEG2RAD, glm::vec3(0.0f, 0.0f, 1.0f));
+    plane.position = glm::vec3(0.0f, c.altitude, 0.0f);
+    plane.velocity = path * glm::vec3(c.speed, 0.0f, 0.0f);
+    plane.orientation = glm::normalize(q);
+    // steady turn: the body turns with the heading
+    plane.angularVelocity = glm::vec3(glm::conjugate(plane.orientation) * glm::vec4(up * c.turnRate, 0.0f));
+    plane.thrust = x[2];
+    plane.controls = glm::vec3(x[3], x[4], x[5]);
+}
+
+// ---------------------------
+// Exact Jacobian: the same state built on Dual<6>, one derivative pass
+// ---------------------------
+using TrimDual = Dual<TRIM_UNKNOWNS>;
+
+static glm::qua<TrimDual> axisAngle(const TrimDual& angle, const glm::vec3& axis)
+{
+    // glm::angleAxis calls glm::sin, which only takes built-in floats
+    TrimDual h = angle * 0.5f, sh = sin(h);
+    return glm::qua<TrimDual>(cos(h), sh * axis.x, sh * axis.y, sh * axis.z);
+}
+
+static glm::qua<TrimDual> constant(const glm::quat& q)
+{
+    return glm::qua<TrimDual>(TrimDual(q.w), TrimDual(q.x), TrimDual(q.y), TrimDual(q.z));
+}
+
+// residual rows r (m) and their partials J (m x n, row-major, active
+// unknowns cols) at x; plane is only read
+static void trimJacobian(Aircraft& plane, const TrimCondition& c, const float* x, const int* cols, int n,
+                         const int* rows, int m, float* r, float* J)
+{
+    TrimDual u[TRIM_UNKNOWNS];
+    for (int i = 0; i < TRIM_UNKNOWNS; ++i) u[i] = TrimDual::variable(x[i], i);
+
+    const glm::vec3 up(0.0f, 1.0f, 0.0f), zAxis(0.0f, 0.0f, 1.0f);
+    glm::quat path = glm::angleAxis(c.climbDeg * DEG2RAD, zAxis);
+    glm::qua<TrimDual> q = constant(path) * axisAngle(u[1] * DEG2RAD, glm::vec3(1.0f, 0.0f, 0.0f))
+                         * constant(glm::angleAxis(c.sideslipDeg * DEG2RAD, up))
+                         * axisAngle(-u[0] * DEG2RAD, zAxis);
+
+    RigidStateOf<TrimDual> s;
+    s.position = glm::vec<3, TrimDual>(TrimDual(0.0f), TrimDual(c.altitude), TrimDual(0.0f));
+    const glm::vec3 velocity = path * glm::vec3(c.speed, 0.0f, 0.0f);
+    s.velocity = glm::vec<3, TrimDual>(velocity);
+    s.orientation = q / sqrt(glm::dot(q, q));     // glm::normalize(qua) calls glm::sqrt
+    s.angularVelocity = glm::conjugate(s.orientation) * glm::vec<3, TrimDual>(TrimDual(0.0f), TrimDual(c.turnRate),
+                                                                             TrimDual(0.0f));
+    RigidDerivativeOf<TrimDual> d =
+        aircraftDerivative(plane, s, u[2], glm::vec<3, TrimDual>(u[3], u[4], u[5]));
+
+    glm::vec3 need = glm::cross(glm::vec3(0.0f, c.turnRate, 0.0f), velocity);
+    glm::vec<3, TrimDual> f = glm::conjugate(s.orientation) * (d.dVelocity - glm::vec<3, TrimDual>(need));
+    const TrimDual all[TRIM_UNKNOWNS] = {f.x, f.y, f.z, d.dAngularVelocity.x, d.dAngularVelocity.y,
+                                         d.dAngularVelocity.z};
+    for (int i = 0; i < m; ++i) {
+        r[i] = all[rows[i]].v;
+        for (int j = 0; j < n; ++j) J[i * n + j] = all[rows[i]].d[cols[j]];
+    }
+}
+
+// the active rows of: acceleration left over once the turn's centripetal
+// part is taken out (body axes), then the angular acceleration
+static void trimResidual(const Aircraft& plane, const TrimCondition& c, const RigidDerivative& d,
+                         const int* rows, int m, float* r)
+{
+    glm::vec3 need = glm::cross(glm::vec3(0.0f, c.turnRate, 0.0f), plane.velocity);
+    glm::vec3 f = glm::vec3(glm::conjugate(plane.orientation) * glm::vec4(d.dVelocity - need, 0.0f));
+    const float all[TRIM_UNKNOWNS] = {f.x, f.y, f.z, d.dAngularVelocity.x, d.dAngularVelocity.y, d.dAngularVelocity.z};
+    for (int i = 0; i < m; ++i) r[i] = all[rows[i]];
+}
+
+static float norm(const float* r, int m)
+{
+    double s = 0.0;
+    for (int i = 0; i < m; ++i) s += double(r[i]) * double(r[i]);
+    return float(std::sqrt(s));
+}
+
+// (J^T J + lambda diag(J^T J)) dx = -J^T r, J m x n row-major; false if singular
+static bool dampedStep(const float* J, const float* r, int m, int n, float lambda, float* dx)
+{
+    double A[TRIM_UNKNOWNS][TRIM_UNKNOWNS + 1];
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            double s = 0.0;
+            for (int k = 0; k < m; ++k) s += double(J[k * n + i]) * double(J[k * n + j]);
+            A[i][j] = s;
+        }
+        double b = 0.0;
+        for (int k = 0; k < m; ++k) b -= double(J[k * n + i]) * double(r[k]);
+        A[i][n] = b;
+    }
+    for (int i = 0; i < n; ++i) A[i][i] += lambda * A[i][i] + 1e-12;
+
+    // Gaussian elimination, partial pivoting
+    for (int c = 0; c < n; ++c) {
+        int p = c;
+        for (int i = c + 1; i < n; ++i)
+            if (std::fabs(A[i][c]) > std::fabs(A[p][c])) p = i;
+        if (std::fabs(A[p][c]) < 1e-15) return false;
+        if (p != c)
+            for (int j = c; j <= n; ++j) std::swap(A[p][j], A[c][j]);
+        for (int i = c + 1; i < n; ++i) {
+            double f = A[i][c] / A[c][c];
+            for (int j = c; j <= n; ++j) A[i][j] -= f * A[c][j];
+        }
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        double s = A[i][n];
+        for (int j = i + 1; j < n; ++j) s -= A[i][j] * dx[j];
+        dx[i] = float(s / A[i][i]);
+    }
+    return true;
+}
+
+// ---------------------------
+// Lockstep solver
+// ---------------------------
+namespace {
+struct TrimWork {
+    float x[TRIM_UNKNOWNS];         // accepted point
+    float r[TRIM_UNKNOWNS];         // residual there
+    float J[TRIM_UNKNOWNS * TRIM_UNKNOWNS];
+    float trial[TRIM_UNKNOWNS];     // point evaluated this iteration
+    float resNorm = 0.0f;
+    float lambda = 1e-3f;
+    bool accepted = false;          // x/r/J hold a point
+    bool done = false;
+};
+}
+
+// Which controls the model responds to, and the moment row each one trims:
+// one deflection of each control at the starting point of the first
+// condition, then every control that moves anything is paired with the
+// strongest axis it reaches that no stronger control has taken, so the
+// system stays square. Rows left over are not trimmed (the lumped model has
+// no controls at all; the default strip wing has ailerons only).
+static void activeControls(const Aircraft& plane, const TrimCondition& c, const float* x0,
+                           int* cols, int& n, int* rows, int& m)
+{
+    const float DEFLECT = 0.05f;
+    Aircraft probe[4] = {plane, plane, plane, plane};
+    for (int j = 0; j < 4; ++j) {
+        float x[TRIM_UNKNOWNS];
+        std::copy(x0, x0 + TRIM_UNKNOWNS, x);
+        if (j > 0) x[2 + j] += DEFLECT;
+        setTrimState(probe[j], c, x);
+    }
+    RigidDerivative d[4];
+    aircraftDerivatives(probe, 4, d, false);
+
+    float effect[3][3];     // [control][moment axis]
+    float largest = 0.0f;
+    for (int j = 0; j < 3; ++j)
+        for (int i = 0; i < 3; ++i) {
+            effect[j][i] = std::fabs(d[j + 1].dAngularVelocity[i] - d[0].dAngularVelocity[i]);
+            largest = std::max(largest, effect[j][i]);
+        }
+    const float threshold = std::max(1e-3f * largest, 1e-6f);
+
+    n = 0; m = 0;
+    for (int k = 0; k < 3; ++k) cols[n++] = rows[m++] = k;
+    bool controlUsed[3] = {}, rowUsed[3] = {};
+    for (;;) {
+        int bj = -1, bi = -1;
+        for (int j = 0; j < 3; ++j)
+            for (int i = 0; i < 3; ++i)
+                if (!controlUsed[j] && !rowUsed[i] && effect[j][i] > threshold &&
+                    (bj < 0 || effect[j][i] > effect[bj][bi])) { bj = j; bi = i; }
+        if (bj < 0) break;
+        controlUsed[bj] = rowUsed[bi] = true;
+        cols[n++] = 3 + bj;
+        rows[m++] = 3 + bi;
+    }
+}
+
+// the same for every condition of a call
+static void startPoint(const Aircraft& plane, const TrimOptions& options, float* x0)
+{
+    const float weight = plane.mass * GRAVITY;
+    const float x[TRIM_UNKNOWNS] = {options.alphaDeg, options.bankDeg,
+                                    options.thrust >= 0.0f ? options.thrust : 0.1f * weight,
+                                    options.controls.x, options.controls.y, options.controls.z};
+    std::copy(x, x + TRIM_UNKNOWNS, x0);
+}
+
+// one lockstep batch over the active unknowns (cols) and residual rows the
+// caller resolved
+static void trimLockstep(const Aircraft& plane, const TrimCondition* conditions, TrimSolution* out, size_t count,
+                         const TrimOptions& options, const float* x0, const int* cols, int n, const int* rows, int m)
+{
+    const float weight = plane.mass * GRAVITY;
+
+    // exact Jacobians where the model has a dual-number path, else forward
+    // differences with these steps; and per-iteration step bounds, per unknown
+    const bool exact = options.exactJacobian && dualDerivatives(plane);
+    Aircraft model = plane;
+    const float h[TRIM_UNKNOWNS] = {1e-2f, 1e-2f, 1e-3f * weight, 1e-3f, 1e-3f, 1e-3f};
+    const float maxStep[TRIM_UNKNOWNS] = {10.0f, 20.0f, 0.5f * weight, 0.1f, 0.1f, 0.1f};
+
+    std::vector<TrimWork> work(count);
+    for (size_t c = 0; c < count; ++c) {
+        std::copy(x0, x0 + TRIM_UNKNOWNS, work[c].trial);
+        out[c] = TrimSolution();
+        for (int k = 3; k < n; ++k) out[c].trimmedControls[cols[k] - 3] = true;
+    }
+
+    // finite differences: base point + one perturbation per active unknown,
+    // for every condition still iterating, evaluated in one call
+    const size_t stride = exact ? 0 : size_t(n) + 1;
+    std::vector<Aircraft> batch(count * stride, plane);
+    std::vector<RigidDerivative> deriv(batch.size());
+    std::vector<size_t> live;
+    float rt[TRIM_UNKNOWNS], rp[TRIM_UNKNOWNS], Jt[TRIM_UNKNOWNS * TRIM_UNKNOWNS];
+
+    for (int iter = 0; iter <= options.maxIterations; ++iter) {
+        live.clear();
+        for (size_t c = 0; c < count; ++c)
+            if (!work[c].done) live.push_back(c);
+        if (live.empty()) break;
+
+        for (size_t k = 0; k < live.size() && !exact; ++k) {
+            const size_t c = live[k];
+            float xp[TRIM_UNKNOWNS];
+            for (size_t j = 0; j < stride; ++j) {
+                std::copy(work[c].trial, work[c].trial + TRIM_UNKNOWNS, xp);
+                if (j > 0) xp[cols[j - 1]] += h[cols[j - 1]];
+                setTrimState(batch[k * stride + j], conditions[c], xp);
+            }
+        }
+        if (!exact) aircraftDerivatives(batch.data(), live.size() * stride, deriv.data(), false);
+
+        for (size_t k = 0; k < live.size(); ++k) {
+            const size_t c = live[k];
+            TrimWork& w = work[c];
+            const TrimCondition& cond = conditions[c];
+            const Aircraft* b = exact ? nullptr : &batch[k * stride];
+            const RigidDerivative* d = exact ? nullptr : &deriv[k * stride];
+
+            if (exact)
+                trimJacobian(model, cond, w.trial, cols, n, rows, m, rt, Jt);
+            else
+                trimResidual(b[0], cond, d[0], rows, m, rt);
+            float trialNorm = norm(rt, m);
+            if (!std::isfinite(trialNorm)) trialNorm = INFINITY;
+
+            // Marquardt: keep a better point and trust the model more, else back off
+            if (!w.accepted || trialNorm < w.resNorm) {
+                for (int j = 0; j < n && !exact; ++j) {
+                    trimResidual(b[j + 1], cond, d[j + 1], rows, m, rp);
+                    for (int i = 0; i < m; ++i) Jt[i * n + j] = (rp[i] - rt[i]) / h[cols[j]];
+                }
+                std::copy(w.trial, w.trial + TRIM_UNKNOWNS, w.x);
+                std::copy(rt, rt + m, w.r);
+                std::copy(Jt, Jt + m * n, w.J);
+                w.resNorm = trialNorm;
+                w.lambda = std::max(w.lambda * 0.3f, 1e-7f);
+                w.accepted = true;
+            } else {
+                w.lambda *= 4.0f;
+            }
+
+            TrimSolution& s = out[c];
+            s.iterations = iter;
+            if (w.resNorm < options.tolerance || w.lambda > 1e8f || iter == options.maxIterations) {
+                s.converged = w.resNorm < options.tolerance;
+                w.done = true;
+                continue;
+            }
+
+            float dx[TRIM_UNKNOWNS] = {};
+            if (!dampedStep(w.J, w.r, m, n, w.lambda, dx)) w.lambda *= 4.0f;
+            std::copy(w.x, w.x + TRIM_UNKNOWNS, w.trial);
+            for (int j = 0; j < n; ++j) w.trial[cols[j]] += std::clamp(dx[j], -maxStep[cols[j]], maxStep[cols[j]]);
+            w.trial[2] = std::clamp(w.trial[2], 0.0f, options.maxThrust);
+            for (int j = 3; j < TRIM_UNKNOWNS; ++j)
+                w.trial[j] = std::clamp(w.trial[j], -options.controlLimit, options.controlLimit);
+        }
+    }
+
+    // final state and leftovers at the accepted points
+    Aircraft probe = plane;
+    for (size_t c = 0; c < count; ++c) {
+        const TrimWork& w = work[c];
+        TrimSolution& s = out[c];
+        s.residual = w.resNorm;
+        s.alphaDeg = w.x[0];
+        s.bankDeg = w.x[1];
+        s.thrust = w.x[2];
+        s.controls = glm::vec3(w.x[3], w.x[4], w.x[5]);
+
+        setTrimState(probe, conditions[c], w.x);
+        s.state = aircraftState(probe);
+        RigidDerivative d = aircraftDerivative(probe, s.state, false, false);
+        s.angularAcceleration = d.dAngularVelocity;
+    }
+}
+
+void trimAircraft(const Aircraft& plane, const TrimCondition* conditions, TrimSolution* out, size_t count,
+                  const TrimOptions& options)
+{
+    if (count == 0) return;
+
+    float x0[TRIM_UNKNOWNS];
+    int cols[TRIM_UNKNOWNS], rows[TRIM_UNKNOWNS], n, m;
+    startPoint(plane, options, x0);
+    activeControls(plane, conditions[0], x0, cols, n, rows, m);
+    trimLockstep(plane, conditions, out, count, options, x0, cols, n, rows, m);
+}
+
+TrimSolution trimAircraft(const Aircraft& plane, const TrimCondition& condition, const TrimOptions& options)
+{
+    TrimSolution s;
+    trimAircraft(plane, &condition, &s, 1, options);
+    return s;
+}
+
+void trimAircraft(ThreadPool& pool, const Aircraft& plane, const TrimCondition* conditions, TrimSolution* out,
+                  size_t count, const TrimOptions& options, size_t chunk)
+{
+    if (count == 0) return;
+
+    // resolved once from the whole batch's first condition, as the serial
+    // call does, not from each chunk's
+    float x0[TRIM_UNKNOWNS];
+    int cols[TRIM_UNKNOWNS], rows[TRIM_UNKNOWNS], n, m;
+    startPoint(plane, options, x0);
+    activeControls(plane, conditions[0], x0, cols, n, rows, m);
+
+    pool.parallelFor(count, chunk, [&](size_t begin, size_t end, unsigned) {
+        trimLockstep(plane, conditions + begin, out + begin, end - begin, options, x0, cols, n, rows, m);
+    });
+}
+
+void applyTrim(Aircraft& plane, const TrimSolution& trim)
+{
+    setAircraftState(plane, trim.state);
+    plane.thrust = trim.thrust;
+    plane.controls = trim.controls;
+}
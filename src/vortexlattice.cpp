@@ -0,0 +1,324 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "vortexlattice.h"
+#include "physicsengine.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <mutex>
+
+static constexpr double PI_D = 3.14159265358979323846;
+static constexpr float DEG2RAD = 3.14159265358979323846f / 180.0f;
+
+// trailing legs end this many reference spans downstream (stands in for infinity)
+static constexpr double WAKE_SPANS = 1000.0;
+
+// blocking of the batched solves: panel rows per block, aircraft columns per
+// tile; columns are padded to whole LANES so the row updates vectorize
+static constexpr size_t ROW_BLOCK = 16;
+static constexpr size_t COL_TILE = 64;
+static constexpr size_t LANES = 8;
+
+// ---------------------------
+// Biot-Savart: velocity at p from a unit-strength straight vortex a -> b
+// ---------------------------
+static glm::dvec3 segmentVelocity(const glm::dvec3& p, const glm::dvec3& a, const glm::dvec3& b)
+{
+    glm::dvec3 r1 = p - a, r2 = p - b, r0 = b - a;
+    glm::dvec3 c = glm::cross(r1, r2);
+    double c2 = glm::dot(c, c);
+    double l1 = glm::length(r1), l2 = glm::length(r2);
+    // on (or extremely close to) the vortex line: no self-induced velocity
+    if (c2 < 1e-12 * glm::dot(r0, r0) || l1 < 1e-12 || l2 < 1e-12) return glm::dvec3(0.0);
+    double k = glm::dot(r0, r1 / l1 - r2 / l2) / (4.0 * PI_D * c2);
+    return c * k;
+}
+
+// ---------------------------
+// Creation: panels, influence matrix, LU
+// ---------------------------
+std::shared_ptr<const VortexLattice> VortexLattice::create(const std::vector<StripSurface>& surfaces, int chordwise,
+                                                           const AirfoilProperties& props)
+{
+    size_t total = 0;
+    double refSpan = 0.0;
+    for (const StripSurface& s : surfaces) {
+        if (s.strips < 1 || !(s.span > 0.0f) || !(s.rootChord > 0.0f) || !(s.tipChord > 0.0f)) {
+            std::cerr << "VortexLattice: surfaces need at least one strip and positive span/chords\n";
+            return nullptr;
+        }
+        total += size_t(s.strips);
+        refSpan = std::max(refSpan, double(s.span));
+    }
+    if (total == 0 || chordwise < 1) {
+        std::cerr << "VortexLattice: need at least one surface and one chordwise panel\n";
+        return nullptr;
+    }
+
+    std::shared_ptr<VortexLattice> vl(new VortexLattice());
+    const size_t n = total * size_t(chordwise);
+    vl->n = n;
+    for (auto* v : {&vl->cpx, &vl->cpy, &vl->cpz, &vl->mx, &vl->my, &vl->mz, &vl->dlx, &vl->dlz,
+                    &vl->area, &vl->theta, &vl->aileronMix, &vl->elevatorMix})
+        v->resize(n);
+    vl->cd0 = props.cd0;
+
+    // bound vortex endpoints (double) for assembly
+    std::vector<glm::dvec3> A(n), B(n), CP(n), M(n);
+    const double wake = WAKE_SPANS * refSpan;
+
+    size_t i = 0;
+    for (const StripSurface& s : surfaces) {
+        const double half = 0.5 * s.span;
+        const double dz = double(s.span) / s.strips;
+        auto chordAt = [&](double z) { return s.rootChord + (s.tipChord - s.rootChord) * (std::fabs(z) / half); };
+
+        for (int k = 0; k < s.strips; ++k) {
+            const double z0 = -half + k * dz, z1 = z0 + dz, zm = 0.5 * (z0 + z1);
+            const double c0 = chordAt(z0), c1 = chordAt(z1), cm = chordAt(zm);
+            // unswept quarter-chord line at root.x (as in StripWing): leading edge at x + c/4
+            const double le0 = s.root.x + 0.25 * c0, le1 = s.root.x + 0.25 * c1, lem = s.root.x + 0.25 * cm;
+            const bool aileron = s.aileron > 0.0f && std::fabs(zm) >= (1.0 - s.aileron) * half;
+
+            for (int c = 0; c < chordwise; ++c, ++i) {
+                const double f = double(c) / chordwise, df = 1.0 / chordwise;
+                A[i] = glm::dvec3(le0 - c0 * (f + 0.25 * df), s.root.y, s.root.z + z0);
+                B[i] = glm::dvec3(le1 - c1 * (f + 0.25 * df), s.root.y, s.root.z + z1);
+                CP[i] = glm::dvec3(lem - cm * (f + 0.75 * df), s.root.y, s.root.z + zm);
+                M[i] = 0.5 * (A[i] + B[i]);
+
+                vl->cpx[i] = float(CP[i].x); vl->cpy[i] = float(CP[i].y); vl->cpz[i] = float(CP[i].z);
+                vl->mx[i] = float(M[i].x);   vl->my[i] = float(M[i].y);   vl->mz[i] = float(M[i].z);
+                vl->dlx[i] = float(B[i].x - A[i].x);
+                vl->dlz[i] = float(B[i].z - A[i].z);
+                vl->area[i] = float(0.5 * (c0 + c1) * df * dz);
+                // camber enters as an incidence offset of minus the zero-lift angle
+                vl->theta[i] = (s.incidenceDeg - props.zeroLiftDeg) * DEG2RAD;
+                // positive aileron raises the right (+z) wing's incidence
+                vl->aileronMix[i] = aileron ? (zm > 0.0 ? 1.0f : -1.0f) : 0.0f;
+                vl->elevatorMix[i] = s.elevator;
+            }
+        }
+    }
+
+    // influence matrix: y-velocity at control point r from unit horseshoe j;
+    // downwash: y-velocity at bound midpoint r from j's trailing legs only
+    std::vector<double> aic(n * n);
+    vl->downwash.resize(n * n);
+    for (size_t j = 0; j < n; ++j) {
+        const glm::dvec3 aInf = A[j] - glm::dvec3(wake, 0.0, 0.0);
+        const glm::dvec3 bInf = B[j] - glm::dvec3(wake, 0.0, 0.0);
+        for (size_t r = 0; r < n; ++r) {
+            glm::dvec3 v = segmentVelocity(CP[r], aInf, A[j]) + segmentVelocity(CP[r], A[j], B[j]) +
+                           segmentVelocity(CP[r], B[j], bInf);
+            aic[r * n + j] = v.y;
+            glm::dvec3 w = segmentVelocity(M[r], aInf, A[j]) + segmentVelocity(M[r], B[j], bInf);
+            vl->downwash[r * n + j] = float(w.y);
+        }
+    }
+
+    // LU with partial pivoting, in double
+    std::vector<uint32_t> perm(n);
+    for (size_t r = 0; r < n; ++r) perm[r] = uint32_t(r);
+    for (size_t k = 0; k < n; ++k) {
+        size_t p = k;
+        for (size_t r = k + 1; r < n; ++r)
+            if (std::fabs(aic[r * n + k]) > std::fabs(aic[p * n + k])) p = r;
+        if (std::fabs(aic[p * n + k]) < 1e-12) {
+            std::cerr << "VortexLattice: singular influence matrix (overlapping panels?)\n";
+            return nullptr;
+        }
+        if (p != k) {
+            std::swap_ranges(aic.begin() + k * n, aic.begin() + (k + 1) * n, aic.begin() + p * n);
+            std::swap(perm[k], perm[p]);
+        }
+        const double inv = 1.0 / aic[k * n + k];
+        for (size_t r = k + 1; r < n; ++r) {
+            double l = aic[r * n + k] * inv;
+            aic[r * n + k] = l;
+            if (l == 0.0) continue;
+            for (size_t c = k + 1; c < n; ++c) aic[r * n + c] -= l * aic[k * n + c];
+        }
+    }
+
+    vl->lu.resize(n * n);
+    vl->invDiag.resize(n);
+    for (size_t e = 0; e < n * n; ++e) vl->lu[e] = float(aic[e]);
+    for (size_t r = 0; r < n; ++r) vl->invDiag[r] = float(1.0 / aic[r * n + r]);
+    vl->perm = std::move(perm);
+    return vl;
+}
+
+// ---------------------------
+// Batched solve
+// ---------------------------
+// y -= a * x over cw columns, whole LANES first (fixed trip count, vectorizes)
+static inline void rowUpdate(float* __restrict y, const float* __restrict x, float a, size_t cw)
+{
+    size_t c = 0;
+    for (; c + LANES <= cw; c += LANES)
+        for (size_t l = 0; l < LANES; ++l) y[c + l] -= a * x[c + l];
+    for (; c < cw; ++c) y[c] -= a * x[c];
+}
+
+// X (n x ld, row-major): X := U^-1 L^-1 X, blocked over rows
+// so each solved row is streamed once per block rather than once per row
+static void solveLU(const float* lu, const float* invDiag, size_t n, float* X, size_t ld)
+{
+    for (size_t c0 = 0; c0 < ld; c0 += COL_TILE) {
+        const size_t cw = std::min(COL_TILE, ld - c0);
+        auto row = [&](size_t r) { return X + r * ld + c0; };
+
+        // forward: unit lower
+        for (size_t i0 = 0; i0 < n; i0 += ROW_BLOCK) {
+            const size_t i1 = std::min(n, i0 + ROW_BLOCK);
+            for (size_t k = 0; k < i0; ++k) {
+                const float* xk = row(k);
+                for (size_t i = i0; i < i1; ++i) rowUpdate(row(i), xk, lu[i * n + k], cw);
+            }
+            for (size_t i = i0; i < i1; ++i) {
+                float* xi = row(i);
+                for (size_t k = i0; k < i; ++k) rowUpdate(xi, row(k), lu[i * n + k], cw);
+            }
+        }
+
+        // backward: upper
+        for (size_t b1 = n; b1 > 0;) {
+            const size_t b0 = b1 > ROW_BLOCK ? b1 - ROW_BLOCK : 0;
+            for (size_t k = b1; k < n; ++k) {
+                const float* xk = row(k);
+                for (size_t i = b0; i < b1; ++i) rowUpdate(row(i), xk, lu[i * n + k], cw);
+            }
+            for (size_t i = b1; i-- > b0;) {
+                float* xi = row(i);
+                for (size_t k = i + 1; k < b1; ++k) rowUpdate(xi, row(k), lu[i * n + k], cw);
+                const float d = invDiag[i];
+                for (size_t c = 0; c < cw; ++c) xi[c] *= d;
+            }
+            b1 = b0;
+        }
+    }
+}
+
+// Y (n x ld) = W (n x n) * X (n x ld), same blocking
+static void multiply(const float* W, size_t n, const float* X, float* Y, size_t ld)
+{
+    std::fill(Y, Y + n * ld, 0.0f);
+    for (size_t c0 = 0; c0 < ld; c0 += COL_TILE) {
+        const size_t cw = std::min(COL_TILE, ld - c0);
+        for (size_t i0 = 0; i0 < n; i0 += ROW_BLOCK) {
+            const size_t i1 = std::min(n, i0 + ROW_BLOCK);
+            for (size_t k = 0; k < n; ++k) {
+                const float* xk = X + k * ld + c0;
+                for (size_t i = i0; i < i1; ++i) rowUpdate(Y + i * ld + c0, xk, -W[i * n + k], cw);
+            }
+        }
+    }
+}
+
+void VortexLattice::evaluateBatch(const glm::vec3* velBody, const glm::vec3* omega, const glm::vec3* controls,
+                                  StripLoads* out, size_t count, float rho, float* circulation) const
+{
+    if (count == 0) return;
+    // padding columns stay zero; a lone aircraft is solved unpadded
+    const size_t ld = count < LANES ? count : (count + LANES - 1) / LANES * LANES;
+    std::vector<float> gamma(n * ld, 0.0f), w(n * ld);
+
+    // right-hand side: -(U . n) with U = -(v + omega x r) the air velocity at
+    // each control point and n the panel normal tilted by its incidence;
+    // rows are stored pivoted so the solve needs no permutation pass
+    for (size_t r = 0; r < n; ++r) {
+        const uint32_t p = perm[r];
+        float* row = gamma.data() + r * ld;
+        for (size_t a = 0; a < count; ++a) {
+            const glm::vec3& v = velBody[a];
+            const glm::vec3& o = omega[a];
+            const float ux = -(v.x + (o.y * cpz[p] - o.z * cpy[p]));
+            const float uy = -(v.y + (o.z * cpx[p] - o.x * cpz[p]));
+            const float th = theta[p] + aileronMix[p] * controls[a].x + elevatorMix[p] * controls[a].y;
+            row[a] = -(-ux * std::sin(th) + uy * std::cos(th));
+        }
+    }
+
+    solveLU(lu.data(), invDiag.data(), n, gamma.data(), ld);
+    multiply(downwash.data(), n, gamma.data(), w.data(), ld);
+
+    // Kutta-Joukowski on each bound vortex with the local (induced-corrected)
+    // flow, plus profile drag; reduced to force and moment about the CG
+    for (size_t a = 0; a < count; ++a) {
+        const glm::vec3& v = velBody[a];
+        const glm::vec3& o = omega[a];
+        glm::vec3 F(0.0f), Mo(0.0f);
+        for (size_t j = 0; j < n; ++j) {
+            const glm::vec3 r(mx[j], my[j], mz[j]);
+            glm::vec3 U = -(v + glm::cross(o, r));
+            const float G = gamma[j * ld + a];
+            glm::vec3 Ui(U.x, U.y + w[j * ld + a], U.z);
+            glm::vec3 f = rho * G * glm::cross(Ui, glm::vec3(dlx[j], 0.0f, dlz[j]));
+
+            const float u2 = U.x * U.x + U.y * U.y;
+            f += glm::vec3(U.x, U.y, 0.0f) * (0.5f * rho * std::sqrt(u2) * area[j] * cd0);
+
+            F += f;
+            Mo += glm::cross(r, f);
+        }
+        out[a].force = F;
+        out[a].moment = Mo;
+    }
+
+    if (circulation) {
+        for (size_t j = 0; j < n; ++j)
+            std::memcpy(circulation + j * count, gamma.data() + j * ld, count * sizeof(float));
+    }
+}
+
+StripLoads VortexLattice::evaluate(const glm::vec3& velBody, const glm::vec3& omega, const glm::vec3& controls,
+                                   float rho, float* circulation) const
+{
+    StripLoads out;
+    evaluateBatch(&velBody, &omega, &controls, &out, 1, rho, circulation);
+    return out;
+}
+
+// ---------------------------
+// Shared lattices
+// ---------------------------
+static std::mutex latticeMutex;
+static std::map<std::vector<float>, std::weak_ptr<const VortexLattice>> latticeCache;
+
+// caller holds latticeMutex
+static void pruneVortexLattices()
+{
+    for (auto it = latticeCache.begin(); it != latticeCache.end();)
+        it = it->second.expired() ? latticeCache.erase(it) : std::next(it);
+}
+
+std::shared_ptr<const VortexLattice> acquireVortexLattice(const std::vector<StripSurface>& surfaces, int chordwise,
+                                                          const AirfoilProperties& props)
+{
+    // key: every input that shapes the factorization or the right-hand side
+    std::vector<float> key = {float(chordwise), props.zeroLiftDeg, props.cd0};
+    for (const StripSurface& s : surfaces) {
+        key.insert(key.end(), {s.root.x, s.root.y, s.root.z, s.span, s.rootChord, s.tipChord,
+                               s.incidenceDeg, float(s.strips), s.aileron, s.elevator});
+    }
+
+    std::lock_guard<std::mutex> lock(latticeMutex);
+    auto it = latticeCache.find(key);
+    if (it != latticeCache.end())
+        if (auto vl = it->second.lock()) return vl;
+
+    // a miss factors the whole lattice, so the sweep over the map is noise
+    pruneVortexLattices();
+    auto vl = VortexLattice::create(surfaces, chordwise, props);
+    if (vl) latticeCache[std::move(key)] = vl;
+    return vl;
+}
+
+size_t liveVortexLatticeCount()
+{
+    std::lock_guard<std::mutex> lock(latticeMutex);
+    pruneVortexLattices();
+    return latticeCache.size();
+}
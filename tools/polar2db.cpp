@@ -0,0 +1,95 @@
+// polar2db: convert XFOIL-style text polars into a binary polar database.
+//
+//   polar2db out.pdb polar1.txt [polar2.txt ...]
+//
+// XFOIL polar files (header, dashed separator, then "alpha CL CD CDp CM ...")
+// are read directly. Plain "alpha Cl Cd [Cm]" tables are accepted too; a
+// missing Cm column falls back to estimateCm.
+#define GLM_ENABLE_EXPERIMENTAL
+#include "polardb.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static std::string trim(const std::string& s)
+{
+    size_t a = s.find_first_not_of(" \t\r\n");
+    size_t b = s.find_last_not_of(" \t\r\n");
+    return (a == std::string::npos) ? std::string() : s.substr(a, b - a + 1);
+}
+
+static std::string fileStem(const std::string& path)
+{
+    size_t slash = path.find_last_of("/\\");
+    std::string base = (slash == std::string::npos) ? path : path.substr(slash + 1);
+    size_t dot = base.find_last_of('.');
+    return (dot == std::string::npos) ? base : base.substr(0, dot);
+}
+
+static bool parsePolar(const std::string& path, PolarDbSource& out)
+{
+    std::ifstream in(path);
+    if (!in) { std::cerr << "polar2db: cannot open " << path << "\n"; return false; }
+
+    out.name = fileStem(path);
+    out.curve.clear();
+
+    bool xfoil = false;       // saw the dashed separator of an XFOIL polar
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string t = trim(line);
+        if (t.empty()) continue;
+
+        size_t tag = t.find("Calculated polar for:");
+        if (tag != std::string::npos) {
+            std::string n = trim(t.substr(tag + 21));
+            if (!n.empty()) out.name = n;
+            continue;
+        }
+        if (t.compare(0, 6, "------") == 0) { xfoil = true; out.curve.clear(); continue; }
+
+        std::istringstream ss(t);
+        std::vector<float> v;
+        float x;
+        while (ss >> x) v.push_back(x);
+        if (!ss.eof() || v.size() < 3) continue;   // header/comment line
+
+        float Cm;
+        if (xfoil) Cm = (v.size() >= 5) ? v[4] : estimateCm(v[0]);
+        else       Cm = (v.size() >= 4) ? v[3] : estimateCm(v[0]);
+        out.curve.push_back(glm::vec4(v[0], v[1], v[2], Cm));
+    }
+
+    if (out.curve.empty()) { std::cerr << "polar2db: no polar rows in " << path << "\n"; return false; }
+
+    // XFOIL sweeps may run in either direction and repeat converged points
+    std::stable_sort(out.curve.begin(), out.curve.end(),
+                     [](const glm::vec4& a, const glm::vec4& b) { return a.x < b.x; });
+    out.curve.erase(std::unique(out.curve.begin(), out.curve.end(),
+                                [](const glm::vec4& a, const glm::vec4& b) { return a.x == b.x; }),
+                    out.curve.end());
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        std::cerr << "usage: polar2db out.pdb polar1.txt [polar2.txt ...]\n";
+        return 1;
+    }
+
+    std::vector<PolarDbSource> airfoils;
+    for (int i = 2; i < argc; ++i) {
+        PolarDbSource src;
+        if (!parsePolar(argv[i], src)) return 1;
+        airfoils.push_back(std::move(src));
+    }
+
+    if (!writePolarDatabase(argv[1], airfoils)) return 1;
+
+    std::cout << "wrote " << airfoils.size() << " airfoils to " << argv[1] << "\n";
+    return 0;
+}